@@ -0,0 +1,165 @@
+// Regression gate for the toggle benchmark: compares the JSON results of a run against a stored baseline and fails
+// when a case got slower, or draws or allocates more, than the allowed thresholds.
+//
+// usage: compare baseline.json current.json [-t time_pct] [-c count_pct]
+//   -t: allowed ns/frame increase in percent (default 15)
+//   -c: allowed vertex and allocation count increase in percent (default 0)
+//
+// exit code: 0 when no case regressed, 1 on a regression, 2 on bad input.
+// Only the format written by main.c is understood, this is not a general JSON parser.
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CASES 64
+
+typedef struct {
+  char name[64];
+  double ns_per_frame;
+  double vtx_per_frame;
+  double allocs_per_frame;
+} CaseResult;
+
+typedef struct {
+  int toggles;
+  int num_cases;
+  CaseResult cases[MAX_CASES];
+} RunResult;
+
+static char *readFile(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  char *data = size >= 0 ? (char *)malloc((size_t)size + 1) : NULL;
+  if (data != NULL) {
+    const size_t read = fread(data, 1, (size_t)size, f);
+    data[read] = '\0';
+  }
+  fclose(f);
+  return data;
+}
+
+// Finds `"key":` between `begin` and `end` and parses the number after it.
+static bool readNumber(const char *begin, const char *end, const char *key, double *out)
+{
+  char pattern[64];
+  snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+  const char *p = strstr(begin, pattern);
+  if (p == NULL || (end != NULL && p >= end))
+    return false;
+  char *number_end;
+  *out = strtod(p + strlen(pattern), &number_end);
+  return number_end != p + strlen(pattern);
+}
+
+static bool loadRun(const char *path, RunResult *run)
+{
+  char *data = readFile(path);
+  if (data == NULL) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return false;
+  }
+
+  bool ok = true;
+  double toggles = 0.0;
+  const char *cases = strstr(data, "\"cases\":");
+  if (cases == NULL || !readNumber(data, cases, "toggles", &toggles)) {
+    fprintf(stderr, "%s: not a benchmark result\n", path);
+    ok = false;
+  }
+  run->toggles = (int)toggles;
+  run->num_cases = 0;
+
+  // one object per case: {"name": "...", "key": value, ...}
+  for (const char *p = ok ? strchr(cases, '{') : NULL; p != NULL; p = strchr(p, '{')) {
+    const char *end = strchr(p, '}');
+    const char *name = strstr(p, "\"name\": \"");
+    if (end == NULL || name == NULL || name > end || run->num_cases == MAX_CASES) {
+      fprintf(stderr, "%s: malformed case\n", path);
+      ok = false;
+      break;
+    }
+    CaseResult *c = &run->cases[run->num_cases++];
+    name += strlen("\"name\": \"");
+    const size_t name_len = (size_t)(strchr(name, '"') - name);
+    snprintf(c->name, sizeof(c->name), "%.*s", (int)name_len, name);
+    if (!readNumber(p, end, "ns_per_frame", &c->ns_per_frame) ||
+        !readNumber(p, end, "vtx_per_frame", &c->vtx_per_frame) ||
+        !readNumber(p, end, "allocs_per_frame", &c->allocs_per_frame)) {
+      fprintf(stderr, "%s: case %s is missing a field\n", path, c->name);
+      ok = false;
+      break;
+    }
+    p = end;
+  }
+  free(data);
+  return ok;
+}
+
+// Prints one metric and returns true when `current` exceeds `baseline` by more than `pct` percent.
+static bool checkMetric(const char *case_name, const char *metric, double baseline, double current, double pct)
+{
+  const bool regressed = current > baseline * (1.0 + pct / 100.0) + 1e-6;
+  const double delta = baseline > 0.0 ? (current - baseline) * 100.0 / baseline : (current > 0.0 ? 100.0 : 0.0);
+  printf("%-20s %-16s %14.1f %14.1f %+8.1f%%%s\n", case_name, metric, baseline, current, delta, regressed ? "  REGRESSION" : "");
+  return regressed;
+}
+
+int main(int argc, char **argv)
+{
+  double time_pct = 15.0, count_pct = 0.0;
+  const char *paths[2] = {NULL, NULL};
+  int num_paths = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+      time_pct = atof(argv[++i]);
+    else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+      count_pct = atof(argv[++i]);
+    else if (num_paths < 2)
+      paths[num_paths++] = argv[i];
+    else
+      num_paths = 3;
+  }
+  if (num_paths != 2) {
+    fprintf(stderr, "usage: %s baseline.json current.json [-t time_pct] [-c count_pct]\n", argv[0]);
+    return 2;
+  }
+
+  static RunResult baseline, current;
+  if (!loadRun(paths[0], &baseline) || !loadRun(paths[1], &current))
+    return 2;
+  if (baseline.toggles != current.toggles) {
+    fprintf(stderr, "toggle counts differ: %d in %s, %d in %s\n", baseline.toggles, paths[0], current.toggles, paths[1]);
+    return 2;
+  }
+
+  int regressions = 0;
+  printf("%-20s %-16s %14s %14s %9s\n", "case", "metric", "baseline", "current", "delta");
+  for (int i = 0; i < baseline.num_cases; i++) {
+    const CaseResult *b = &baseline.cases[i];
+    const CaseResult *c = NULL;
+    for (int j = 0; j < current.num_cases && c == NULL; j++)
+      if (strcmp(current.cases[j].name, b->name) == 0)
+        c = &current.cases[j];
+    if (c == NULL) {
+      printf("%-20s missing from %s\n", b->name, paths[1]);
+      regressions++;
+      continue;
+    }
+    regressions += checkMetric(b->name, "ns/frame", b->ns_per_frame, c->ns_per_frame, time_pct);
+    regressions += checkMetric(b->name, "vtx/frame", b->vtx_per_frame, c->vtx_per_frame, count_pct);
+    regressions += checkMetric(b->name, "allocs/frame", b->allocs_per_frame, c->allocs_per_frame, count_pct);
+  }
+
+  if (regressions > 0) {
+    printf("%d regression(s) past the thresholds (time %.1f%%, counts %.1f%%)\n", regressions, time_pct, count_pct);
+    return 1;
+  }
+  printf("no regression (time %.1f%%, counts %.1f%%)\n", time_pct, count_pct);
+  return 0;
+}
@@ -0,0 +1,376 @@
+// Font atlas build cache benchmark: startup cost of ImFontAtlas_Build() (rasterizing every glyph with stb_truetype)
+// against ImFontAtlas_LoadCacheFromDisk() of the file a previous ImFontAtlas_SaveCacheToDisk() wrote, and a check
+// that the loaded atlas is identical to the built one.
+//
+// Built twice by the Makefile: fonts_bench (serial build, the default) and fonts_bench_threaded (IMGUI_USE_THREADED_FONT_BUILD).
+// The cache file holds the whole output of the build, so comparing the files of the two is comparing their atlases.
+//
+// The atlas of the full build is also expanded to RGBA32 by ImFontAtlas_GetTexDataAsRGBA32() ("rgba ms", SIMD where available)
+// and by a plain loop ("loop ms"), which checks the result.
+//
+// The last line builds with ImFontAtlasFlags_LazyGlyphs, rasterizes the glyphs of a screen of text (SCREEN_GLYPHS codepoints
+// spread over the ranges, through ImFont_FindGlyph() in a frame, as ImFont::RenderText() does), then every glyph, and checks
+// that advances, glyphs and their pixels (read with ImFontAtlas_GetTexDataAsAlpha8()) are those of the full build. The same
+// check runs on a font merged from two sources (MergeMode), Greek and Cyrillic from DroidSans added to the font, lazily too.
+//
+// usage: fonts_bench [-font file.ttf] [-size pixels] [-ranges japanese|all] [-r repeats] [-cache file]
+//
+// Without -font the first font found of the ones demo/utils/setupFonts.c looks for is used, then DejaVu Sans, then
+// the DroidSans.ttf that comes with imgui. -ranges all (every glyph of the font up to U+FFFF) is the default, as it
+// gives a comparable glyph count when no CJK font is installed.
+#define CIMGUI_DEFINE_ENUMS_AND_STRUCTS
+#include "cimgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static const char *defaultFonts[] = {
+  "/usr/share/fonts/opentype/noto/NotoSansCJK-Regular.ttc",
+  "/usr/share/fonts/opentype/ipafont-gothic/ipag.ttf",
+  "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+  "../libs/cimgui/imgui/misc/fonts/DroidSans.ttf",
+};
+
+static const ImWchar allRanges[] = { 0x0020, 0xFFFF, 0 };
+
+#define SCREEN_GLYPHS 300
+#define MERGED_FONT "../libs/cimgui/imgui/misc/fonts/DroidSans.ttf"
+
+static double nowNs(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static int compareDouble(const void *a, const void *b)
+{
+  const double da = *(const double *)a, db = *(const double *)b;
+  return da < db ? -1 : da > db ? 1 : 0;
+}
+
+static bool fileExists(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return false;
+  fclose(f);
+  return true;
+}
+
+static long fileSize(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return -1;
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fclose(f);
+  return size;
+}
+
+// A new atlas with the font added, as an application does before building.
+static ImFontAtlas *createAtlas(const char *font_path, float size, const ImWchar *ranges)
+{
+  ImFontAtlas *atlas = ImFontAtlas_ImFontAtlas();
+  ImFontAtlas_AddFontFromFileTTF(atlas, font_path, size, NULL, ranges);
+  return atlas;
+}
+
+// Everything the renderer and text layout read: pixels, glyphs and the lookup tables built from them.
+static bool sameAtlas(ImFontAtlas *a, ImFontAtlas *b)
+{
+  if (a->TexWidth != b->TexWidth || a->TexHeight != b->TexHeight || a->Fonts.Size != b->Fonts.Size || a->CustomRects.Size != b->CustomRects.Size)
+    return false;
+  if (memcmp(a->TexPixelsAlpha8, b->TexPixelsAlpha8, (size_t)a->TexWidth * (size_t)a->TexHeight) != 0)
+    return false;
+  if (memcmp(&a->TexUvWhitePixel, &b->TexUvWhitePixel, sizeof(ImVec2)) != 0 || memcmp(a->TexUvLines, b->TexUvLines, sizeof(a->TexUvLines)) != 0)
+    return false;
+  for (int i = 0; i < a->CustomRects.Size; i++)
+    if (a->CustomRects.Data[i].X != b->CustomRects.Data[i].X || a->CustomRects.Data[i].Y != b->CustomRects.Data[i].Y)
+      return false;
+  for (int i = 0; i < a->Fonts.Size; i++) {
+    const ImFont *fa = a->Fonts.Data[i], *fb = b->Fonts.Data[i];
+    if (fa->Glyphs.Size != fb->Glyphs.Size || fa->IndexLookup.Size != fb->IndexLookup.Size || fa->IndexAdvanceX.Size != fb->IndexAdvanceX.Size)
+      return false;
+    if (memcmp(fa->Glyphs.Data, fb->Glyphs.Data, (size_t)fa->Glyphs.Size * sizeof(ImFontGlyph)) != 0 ||
+        memcmp(fa->IndexLookup.Data, fb->IndexLookup.Data, (size_t)fa->IndexLookup.Size * sizeof(ImWchar)) != 0 ||
+        memcmp(fa->IndexAdvanceX.Data, fb->IndexAdvanceX.Data, (size_t)fa->IndexAdvanceX.Size * sizeof(float)) != 0)
+      return false;
+    if (fa->FontSize != fb->FontSize || fa->Ascent != fb->Ascent || fa->Descent != fb->Descent || fa->FallbackChar != fb->FallbackChar ||
+        fa->EllipsisChar != fb->EllipsisChar || fa->EllipsisWidth != fb->EllipsisWidth || memcmp(fa->Used4kPagesMap, fb->Used4kPagesMap, sizeof(fa->Used4kPagesMap)) != 0)
+      return false;
+  }
+  return true;
+}
+
+// Expands the Alpha8 pixels of a built atlas to RGBA32 through the atlas and with a plain loop, and compares the two.
+static bool checkExpandRGBA32(ImFontAtlas *atlas, double *out_atlas_ns, double *out_loop_ns)
+{
+  unsigned char *alpha8, *rgba32;
+  int width, height;
+  ImFontAtlas_GetTexDataAsAlpha8(atlas, &alpha8, &width, &height, NULL);
+  const size_t count = (size_t)width * (size_t)height;
+  double t0 = nowNs();
+  ImFontAtlas_GetTexDataAsRGBA32(atlas, &rgba32, NULL, NULL, NULL);
+  *out_atlas_ns = nowNs() - t0;
+
+  ImU32 *expected = (ImU32 *)malloc(count * sizeof(ImU32));
+  t0 = nowNs();
+  for (size_t n = 0; n < count; n++)
+    expected[n] = 0x00FFFFFFu | ((ImU32)alpha8[n] << 24);
+  *out_loop_ns = nowNs() - t0;
+  const bool ok = memcmp(expected, rgba32, count * sizeof(ImU32)) == 0;
+  free(expected);
+  return ok;
+}
+
+// The pixels of a glyph, wherever each atlas packed it
+static bool sameGlyphPixels(ImFontAtlas *a, const ImFontGlyph *ga, ImFontAtlas *b, const ImFontGlyph *gb)
+{
+  unsigned char *pixels_a, *pixels_b;
+  int wa, ha, wb, hb;
+  ImFontAtlas_GetTexDataAsAlpha8(a, &pixels_a, &wa, &ha, NULL);
+  ImFontAtlas_GetTexDataAsAlpha8(b, &pixels_b, &wb, &hb, NULL);
+  const int w = (int)(((ga->U1 - ga->U0) * wa) + 0.5f), h = (int)(((ga->V1 - ga->V0) * ha) + 0.5f);
+  if (w != (int)(((gb->U1 - gb->U0) * wb) + 0.5f) || h != (int)(((gb->V1 - gb->V0) * hb) + 0.5f))
+    return false;
+  const int xa = (int)(ga->U0 * wa + 0.5f), ya = (int)(ga->V0 * ha + 0.5f), xb = (int)(gb->U0 * wb + 0.5f), yb = (int)(gb->V0 * hb + 0.5f);
+  for (int y = 0; y < h; y++)
+    if (memcmp(pixels_a + (size_t)(ya + y) * wa + xa, pixels_b + (size_t)(yb + y) * wb + xb, (size_t)w) != 0)
+      return false;
+  return true;
+}
+
+// Looks every glyph of 'font' up in 'lazy_font', which rasterizes the ones it doesn't have yet. Glyphs that don't fit in the
+// texture come back as the fallback until the next frame, which is why this runs in two.
+static bool sameGlyphsLazy(ImFontAtlas *atlas, ImFont *font, ImFontAtlas *lazy_atlas, ImFont *lazy_font)
+{
+  for (int pass = 0; pass < 2; pass++) {
+    igNewFrame();
+    for (int c = 0; c < font->IndexLookup.Size; c++)
+      if (ImFont_FindGlyphNoFallback(font, (ImWchar)c) != NULL)
+        ImFont_FindGlyph(lazy_font, (ImWchar)c);
+    igEndFrame();
+  }
+  if (font->Glyphs.Size != lazy_font->Glyphs.Size)
+    return false;
+  for (int c = 0; c < font->IndexLookup.Size; c++) {
+    const ImFontGlyph *g = ImFont_FindGlyphNoFallback(font, (ImWchar)c);
+    const ImFontGlyph *lazy_g = ImFont_FindGlyphNoFallback(lazy_font, (ImWchar)c);
+    if (g == NULL)
+      continue;
+    if (lazy_g == NULL || g->AdvanceX != lazy_g->AdvanceX || g->X0 != lazy_g->X0 || g->Y0 != lazy_g->Y0 || g->X1 != lazy_g->X1 ||
+        g->Y1 != lazy_g->Y1 || g->Visible != lazy_g->Visible || !sameGlyphPixels(atlas, g, lazy_atlas, lazy_g))
+      return false;
+  }
+  return true;
+}
+
+// Builds 'font_path' with Greek and Cyrillic merged in from MERGED_FONT, in full and with ImFontAtlasFlags_LazyGlyphs, and checks
+// that the merged font rasterizes the glyphs of both sources on first use as the full build does.
+static bool checkMergedLazy(const char *font_path, float size)
+{
+  static const ImWchar base_ranges[] = { 0x0020, 0x024F, 0 };
+  static const ImWchar merged_ranges[] = { 0x0370, 0x04FF, 0 };
+  ImFontAtlas *atlases[2];
+  for (int i = 0; i < 2; i++) {
+    atlases[i] = createAtlas(font_path, size, base_ranges);
+    ImFontConfig *cfg = ImFontConfig_ImFontConfig();
+    cfg->MergeMode = true;
+    ImFontAtlas_AddFontFromFileTTF(atlases[i], MERGED_FONT, size, cfg, merged_ranges);
+    ImFontConfig_destroy(cfg);
+    if (i == 1)
+      atlases[i]->Flags |= ImFontAtlasFlags_LazyGlyphs;
+    ImFontAtlas_Build(atlases[i]);
+  }
+
+  ImGuiContext *ctx = igCreateContext(atlases[1]);
+  ImGuiIO *io = igGetIO();
+  ImVec2 display_size = {1920.0f, 1080.0f};
+  io->IniFilename = NULL;
+  io->DisplaySize = display_size;
+  io->DeltaTime = 1.0f / 60.0f;
+  io->BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;
+  const bool ok = sameGlyphsLazy(atlases[0], atlases[0]->Fonts.Data[0], atlases[1], atlases[1]->Fonts.Data[0]);
+  igDestroyContext(ctx);
+  ImFontAtlas_destroy(atlases[0]);
+  ImFontAtlas_destroy(atlases[1]);
+  return ok;
+}
+
+// A cache written for other inputs, or damaged, must be refused and leave the atlas unbuilt.
+static bool checkRefused(const char *font_path, float size, const ImWchar *ranges, const char *cache_path)
+{
+  bool ok = true;
+  ImFontAtlas *atlas = createAtlas(font_path, size + 1.0f, ranges);
+  ok &= !ImFontAtlas_LoadCacheFromDisk(atlas, cache_path) && !ImFontAtlas_IsBuilt(atlas);
+  ImFontAtlas_destroy(atlas);
+
+  char truncated_path[1024];
+  snprintf(truncated_path, sizeof(truncated_path), "%s.truncated", cache_path);
+  FILE *src = fopen(cache_path, "rb"), *dst = fopen(truncated_path, "wb");
+  const long truncated_size = fileSize(cache_path) - 1;
+  for (long i = 0; src != NULL && dst != NULL && i < truncated_size; i++)
+    fputc(fgetc(src), dst);
+  if (src != NULL)
+    fclose(src);
+  if (dst != NULL)
+    fclose(dst);
+  atlas = createAtlas(font_path, size, ranges);
+  ok &= !ImFontAtlas_LoadCacheFromDisk(atlas, truncated_path) && !ImFontAtlas_IsBuilt(atlas);
+  ImFontAtlas_destroy(atlas);
+  remove(truncated_path);
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  const char *font_path = NULL, *ranges_name = "all", *cache_path = ".build/fonts_bench.cache";
+  float size = 17.0f;
+  int repeats = 5;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "-font") == 0)
+      font_path = argv[i + 1];
+    else if (strcmp(argv[i], "-size") == 0)
+      size = (float)atof(argv[i + 1]);
+    else if (strcmp(argv[i], "-ranges") == 0)
+      ranges_name = argv[i + 1];
+    else if (strcmp(argv[i], "-r") == 0)
+      repeats = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-cache") == 0)
+      cache_path = argv[i + 1];
+  }
+  for (size_t i = 0; font_path == NULL && i < sizeof(defaultFonts) / sizeof(defaultFonts[0]); i++)
+    if (fileExists(defaultFonts[i]))
+      font_path = defaultFonts[i];
+  const bool japanese = strcmp(ranges_name, "japanese") == 0;
+  if (font_path == NULL || !fileExists(font_path) || size <= 0.0f || repeats < 1 || (!japanese && strcmp(ranges_name, "all") != 0)) {
+    fprintf(stderr, "usage: %s [-font file.ttf] [-size pixels] [-ranges japanese|all] [-r repeats] [-cache file]\n", argv[0]);
+    return 1;
+  }
+
+  ImFontAtlas *ranges_atlas = ImFontAtlas_ImFontAtlas();
+  const ImWchar *ranges = japanese ? ImFontAtlas_GetGlyphRangesJapanese(ranges_atlas) : allRanges;
+
+  // cold start: rasterize everything, then save for the next run
+  double *build_ns = (double *)malloc((size_t)repeats * sizeof(double));
+  double *load_ns = (double *)malloc((size_t)repeats * sizeof(double));
+  double save_ns = 0.0;
+  ImFontAtlas *built = NULL;
+  for (int r = 0; r < repeats; r++) {
+    if (built != NULL)
+      ImFontAtlas_destroy(built);
+    built = createAtlas(font_path, size, ranges);
+    const double t0 = nowNs();
+    ImFontAtlas_Build(built);
+    build_ns[r] = nowNs() - t0;
+  }
+  double t0 = nowNs();
+  const bool saved = ImFontAtlas_SaveCacheToDisk(built, cache_path);
+  save_ns = nowNs() - t0;
+
+  // warm start: same inputs, the atlas comes from the file
+  bool ok = saved;
+  for (int r = 0; r < repeats && ok; r++) {
+    ImFontAtlas *loaded = createAtlas(font_path, size, ranges);
+    t0 = nowNs();
+    ok &= ImFontAtlas_LoadCacheFromDisk(loaded, cache_path);
+    load_ns[r] = nowNs() - t0;
+    ok = ok && ImFontAtlas_IsBuilt(loaded) && sameAtlas(built, loaded);
+    ImFontAtlas_destroy(loaded);
+  }
+  ok = ok && checkRefused(font_path, size, ranges, cache_path);
+  double rgba_ns = 0.0, loop_ns = 0.0;
+  ok &= checkExpandRGBA32(built, &rgba_ns, &loop_ns);
+
+  qsort(build_ns, (size_t)repeats, sizeof(double), compareDouble);
+  qsort(load_ns, (size_t)repeats, sizeof(double), compareDouble);
+#if defined(IMGUI_USE_THREADED_FONT_BUILD) && defined(IMGUI_FONT_BUILD_THREADS)
+  char build[32];
+  snprintf(build, sizeof(build), "%d build threads", IMGUI_FONT_BUILD_THREADS);
+#elif defined(IMGUI_USE_THREADED_FONT_BUILD)
+  const char *build = "build threads: one per core";
+#else
+  const char *build = "serial build";
+#endif
+  printf("imgui v%s, %s, %.1f px, %s ranges, %s, %d repeats\n", igGetVersion(), font_path, size, ranges_name, build, repeats);
+  printf("%8s %12s %10s %10s %10s %12s %10s %10s %8s\n", "glyphs", "texture", "build ms", "save ms", "load ms", "cache KB", "rgba ms", "loop ms", "check");
+  char texture[32];
+  snprintf(texture, sizeof(texture), "%dx%d", built->TexWidth, built->TexHeight);
+  printf("%8d %12s %10.2f %10.2f %10.2f %12.1f %10.2f %10.2f %8s\n", built->Fonts.Data[0]->Glyphs.Size, texture, build_ns[repeats / 2] / 1e6,
+         save_ns / 1e6, ok ? load_ns[repeats / 2] / 1e6 : 0.0, fileSize(cache_path) / 1024.0, rgba_ns / 1e6, loop_ns / 1e6, ok ? "ok" : "FAILED");
+
+  // lazy: the glyphs of a screen of text on first use, as ImGui::NewFrame() and ImFont::RenderText() do with a backend that
+  // has ImGuiBackendFlags_RendererHasTexUpdates
+  double *lazy_build_ns = (double *)malloc((size_t)repeats * sizeof(double));
+  ImFontAtlas *lazy = NULL;
+  char lazy_texture[32];
+  for (int r = 0; r < repeats; r++) {
+    if (lazy != NULL)
+      ImFontAtlas_destroy(lazy);
+    lazy = createAtlas(font_path, size, ranges);
+    lazy->Flags |= ImFontAtlasFlags_LazyGlyphs;
+    t0 = nowNs();
+    ImFontAtlas_Build(lazy);
+    lazy_build_ns[r] = nowNs() - t0;
+  }
+  snprintf(lazy_texture, sizeof(lazy_texture), "%dx%d", lazy->TexWidth, lazy->TexHeight);
+  ImFont *font = built->Fonts.Data[0], *lazy_font = lazy->Fonts.Data[0];
+  bool lazy_ok = font->IndexAdvanceX.Size == lazy_font->IndexAdvanceX.Size &&
+                 memcmp(font->IndexAdvanceX.Data, lazy_font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.Size * sizeof(float)) == 0;
+  const int lazy_glyphs = lazy_font->Glyphs.Size;
+
+  ImGuiContext *ctx = igCreateContext(lazy);
+  ImGuiIO *io = igGetIO();
+  ImVec2 display_size = {1920.0f, 1080.0f};
+  io->IniFilename = NULL;
+  io->DisplaySize = display_size;
+  io->DeltaTime = 1.0f / 60.0f;
+  io->BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;
+  int screen_glyphs = 0;
+  t0 = nowNs();
+  igNewFrame();
+  const int step = font->Glyphs.Size / SCREEN_GLYPHS + 1;
+  for (int i = 0; i < font->Glyphs.Size; i += step, screen_glyphs++)
+    ImFont_FindGlyph(lazy_font, (ImWchar)font->Glyphs.Data[i].Codepoint);
+  igEndFrame();
+  igNewFrame();
+  igEndFrame();
+  const double screen_ns = nowNs() - t0;
+  char screen_texture[32];
+  snprintf(screen_texture, sizeof(screen_texture), "%dx%d", lazy->TexWidth, lazy->TexHeight);
+  lazy_ok = lazy_ok && sameGlyphsLazy(built, font, lazy, lazy_font);
+  igDestroyContext(ctx);
+  ok &= lazy_ok;
+
+  qsort(lazy_build_ns, (size_t)repeats, sizeof(double), compareDouble);
+  printf("%8s %12s %10s %12s %10s %12s %8s\n", "lazy", "texture", "build ms", "screen tex", "screen ms", "all texture", "check");
+  snprintf(texture, sizeof(texture), "%dx%d", lazy->TexWidth, lazy->TexHeight);
+  printf("%8d %12s %10.2f %12s %10.2f %12s %8s\n", lazy_glyphs, lazy_texture, lazy_build_ns[repeats / 2] / 1e6, screen_texture,
+         screen_ns / 1e6, texture, lazy_ok ? "ok" : "FAILED");
+  printf("(%d glyphs rasterized by Build(), %d by the first frame of a screen, then all of them for the check)\n", lazy_glyphs, screen_glyphs);
+  const bool merged_ok = !fileExists(MERGED_FONT) || checkMergedLazy(font_path, size);
+  printf("merged font, lazy: %s\n", fileExists(MERGED_FONT) ? (merged_ok ? "ok" : "FAILED") : "skipped, " MERGED_FONT " not found");
+  ok &= merged_ok;
+
+  ImFontAtlas_destroy(lazy);
+  ImFontAtlas_destroy(built);
+  ImFontAtlas_destroy(ranges_atlas);
+  free(build_ns);
+  free(load_ns);
+  free(lazy_build_ns);
+  return ok ? 0 : 1;
+}
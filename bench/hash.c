@@ -0,0 +1,144 @@
+// ID hashing benchmark: throughput and collision count of ImHashStr()/ImHashData() on label sets shaped like the ones
+// toggles are submitted with. Built twice by the Makefile, once per hashing backend of imgui.cpp:
+// hash_bench (CRC32, the default) and hash_bench_fast (IMGUI_USE_FAST_HASH).
+//
+// usage: hash_bench [-n labels] [-r repeats]
+#define CIMGUI_DEFINE_ENUMS_AND_STRUCTS
+#include "cimgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+typedef enum {
+  LabelSet_Short,     // "Toggle 123"
+  LabelSet_Suffix,    // "Enable the experimental option 123##/settings/graphics/advanced/123"
+  LabelSet_Reset,     // "Progress 12%###progress_123"
+  LabelSet_Int,       // PushID(int), hashed with ImHashData()
+  LabelSet_COUNT
+} LabelSet;
+
+static const char *labelSetNames[LabelSet_COUNT] = { "short", "##suffix", "###reset", "int" };
+
+static double nowNs(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+// Writes the `count` labels of a set one after the other, zero terminated, and returns the total length.
+static size_t makeLabels(LabelSet set, int count, char *buf, size_t buf_size, const char **labels)
+{
+  size_t used = 0;
+  for (int i = 0; i < count; i++) {
+    labels[i] = buf + used;
+    int len = 0;
+    switch (set) {
+    case LabelSet_Short:  len = snprintf(buf + used, buf_size - used, "Toggle %d", i); break;
+    case LabelSet_Suffix: len = snprintf(buf + used, buf_size - used, "Enable the experimental option %d##/settings/graphics/advanced/%d", i % 64, i); break;
+    case LabelSet_Reset:  len = snprintf(buf + used, buf_size - used, "Progress %d%%###progress_%d", i % 101, i); break;
+    default: break;
+    }
+    used += (size_t)len + 1;
+  }
+  return used - (size_t)count;
+}
+
+static int compareId(const void *a, const void *b)
+{
+  const ImGuiID ia = *(const ImGuiID *)a, ib = *(const ImGuiID *)b;
+  return ia < ib ? -1 : ia > ib ? 1 : 0;
+}
+
+// Every input of a set is distinct, so equal hashes are collisions.
+static int countCollisions(ImGuiID *ids, int count)
+{
+  qsort(ids, (size_t)count, sizeof(ImGuiID), compareId);
+  int collisions = 0;
+  for (int i = 1; i < count; i++)
+    collisions += ids[i] == ids[i - 1];
+  return collisions;
+}
+
+// The ### operator: only what follows the last ### is hashed, with either string length convention.
+static bool checkResetSemantics(ImGuiID seed)
+{
+  static const char *pairs[][2] = {
+    { "label###id", "###id" }, { "a###b###c", "###c" }, { "x####y", "###y" }, { "##a###b", "###b" },
+  };
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+    ok &= igImHashStr(pairs[i][0], 0, seed) == igImHashStr(pairs[i][1], 0, seed);
+    ok &= igImHashStr(pairs[i][0], strlen(pairs[i][0]), seed) == igImHashStr(pairs[i][0], 0, seed);
+  }
+  ok &= igImHashStr("a##b", 0, seed) != igImHashStr("##b", 0, seed);
+  ok &= igImHashStr("label", 0, seed) == igImHashData("label", 5, seed);
+  return ok;
+}
+
+static const char *backendName(void)
+{
+  // check values of "123456789" for the two CRC32 tables imgui.cpp can use
+  const ImGuiID check = igImHashData("123456789", 9, 0);
+  return check == 0xE3069283 ? "crc32c" : check == 0xCBF43926 ? "crc32 (legacy)" : "fast";
+}
+
+int main(int argc, char **argv)
+{
+  int count = 100000, repeats = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "-n") == 0)
+      count = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-r") == 0)
+      repeats = atoi(argv[i + 1]);
+  }
+  if (count < 1 || repeats < 1) {
+    fprintf(stderr, "usage: %s [-n labels] [-r repeats]\n", argv[0]);
+    return 1;
+  }
+
+  // IDs are hashed with the ID of the window or PushID() scope they are in as the seed
+  const ImGuiID seed = igImHashStr("##bench_window", 0, 0);
+  const bool reset_ok = checkResetSemantics(seed) && checkResetSemantics(0);
+  printf("imgui v%s, hash %s, %d labels x %d repeats, ### semantics %s\n", igGetVersion(), backendName(), count, repeats, reset_ok ? "ok" : "BROKEN");
+  printf("%-10s %8s %10s %10s %11s %10s\n", "set", "avg len", "ns/hash", "MB/s", "collisions", "expected");
+
+  const size_t buf_size = (size_t)count * 96;
+  char *buf = (char *)malloc(buf_size);
+  const char **labels = (const char **)malloc((size_t)count * sizeof(char *));
+  ImGuiID *ids = (ImGuiID *)malloc((size_t)count * sizeof(ImGuiID));
+  for (int set = 0; set < LabelSet_COUNT; set++) {
+    const size_t bytes = set == LabelSet_Int ? (size_t)count * sizeof(int) : makeLabels((LabelSet)set, count, buf, buf_size, labels);
+    const double t0 = nowNs();
+    for (int r = 0; r < repeats; r++) {
+      if (set == LabelSet_Int)
+        for (int i = 0; i < count; i++)
+          ids[i] = igImHashData(&i, sizeof(int), seed);
+      else
+        for (int i = 0; i < count; i++)
+          ids[i] = igImHashStr(labels[i], 0, seed);
+    }
+    const double ns = nowNs() - t0;
+
+    // birthday bound for a 32-bit hash
+    const double expected = (double)count * (count - 1) / 2.0 / 4294967296.0;
+    printf("%-10s %8.1f %10.2f %10.1f %11d %10.2f\n", labelSetNames[set], (double)bytes / count,
+           ns / ((double)count * repeats), (double)bytes * repeats * 1e3 / ns, countCollisions(ids, count), expected);
+  }
+  free(ids);
+  free(labels);
+  free(buf);
+  return reset_ok ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+// Headless toggle benchmark: runs igNewFrame()/igRender() without a GPU, the same way libs/cimgui/test/main.c does,
+// submitting a fixed number of toggles per case and reporting the cost per widget and per frame.
+//
+// usage: bench [-n toggles] [-f frames] [-w warmup_frames] [-json results.json]
+//
+// The JSON results are the input of compare.c, which gates a run against a stored baseline.
+#define CIMGUI_DEFINE_ENUMS_AND_STRUCTS
+#include "cimgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "cimgui_toggle.h"
+#include "cimgui_toggle_presets.h"
+
+#ifdef IMGUI_HAS_IMSTR
+#define igBegin igBegin_Str
+#endif
+
+#define BENCH_COLUMNS 32
+
+typedef enum {
+  BenchKind_Toggle,
+  BenchKind_ToggleAnim,
+  BenchKind_ToggleCfg,
+  BenchKind_ToggleStyled,
+  BenchKind_ToggleArray,
+} BenchKind;
+
+typedef struct {
+  const char *name;
+  BenchKind kind;
+  ImGuiToggleConfig (*preset)(void);
+} BenchCase;
+
+typedef struct {
+  size_t allocs;
+  size_t frees;
+} AllocStats;
+
+typedef struct {
+  double ns_per_frame;      // median over the measured frames
+  double vtx_per_frame;
+  double idx_per_frame;
+  double allocs_per_frame;
+  int draw_cmds;
+  int merged_cmds;          // after ImDrawData_MergeCmdLists(), outside of the measured time
+} BenchResult;
+
+static ImGuiToggleConfig presetDefault(void)   { return ImGuiTogglePresets_DefaultStyle(); }
+static ImGuiToggleConfig presetRectangle(void) { return ImGuiTogglePresets_RectangleStyle(); }
+static ImGuiToggleConfig presetGlowing(void)   { return ImGuiTogglePresets_GlowingStyle(); }
+static ImGuiToggleConfig presetiOS(void)       { return ImGuiTogglePresets_iOSStyle(1.0f, false); }
+static ImGuiToggleConfig presetMaterial(void)  { return ImGuiTogglePresets_MaterialStyle(1.0f); }
+static ImGuiToggleConfig presetMinecraft(void) { return ImGuiTogglePresets_MinecraftStyle(1.0f); }
+
+static const BenchCase benchCases[] = {
+  { "Toggle",             BenchKind_Toggle,       NULL },
+  { "ToggleAnim",         BenchKind_ToggleAnim,   NULL },
+  { "ToggleCfg/Default",  BenchKind_ToggleCfg,    presetDefault },
+  { "ToggleCfg/Rectangle",BenchKind_ToggleCfg,    presetRectangle },
+  { "ToggleCfg/Glowing",  BenchKind_ToggleCfg,    presetGlowing },
+  { "ToggleCfg/iOS",      BenchKind_ToggleCfg,    presetiOS },
+  { "ToggleCfg/Material", BenchKind_ToggleCfg,    presetMaterial },
+  { "ToggleCfg/Minecraft",BenchKind_ToggleCfg,    presetMinecraft },
+  { "ToggleStyled",       BenchKind_ToggleStyled, presetDefault },
+  { "ToggleArray",        BenchKind_ToggleArray,  presetDefault },
+};
+
+static void *benchAlloc(size_t size, void *user_data)
+{
+  ((AllocStats *)user_data)->allocs++;
+  return malloc(size);
+}
+
+static void benchFree(void *ptr, void *user_data)
+{
+  if (ptr != NULL)
+    ((AllocStats *)user_data)->frees++;
+  free(ptr);
+}
+
+static double nowNs(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+// Submits `count` toggles of the given case, BENCH_COLUMNS per row. Every third one is on.
+static void submitToggles(const BenchCase *bench, bool *values, int count, const ImGuiToggleConfig *config, ImGuiToggleStyle *style)
+{
+  const ImVec2 size = {0.0f, 0.0f};
+  if (bench->kind == BenchKind_ToggleArray) {
+    ToggleArray("##array", values, count, config, BENCH_COLUMNS);
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    if (i % BENCH_COLUMNS != 0)
+      igSameLine(0.0f, -1.0f);
+    igPushID_Int(i);
+    switch (bench->kind) {
+    case BenchKind_Toggle:       Toggle("##t", &values[i], size); break;
+    case BenchKind_ToggleAnim:   ToggleAnim("##t", &values[i], ImGuiToggleFlags_Animated, 1.0f, size); break;
+    case BenchKind_ToggleCfg:    ToggleCfgPtr("##t", &values[i], config); break;
+    case BenchKind_ToggleStyled: ToggleStyled("##t", &values[i], style); break;
+    default: break;
+    }
+    igPopID();
+  }
+}
+
+static int compareDouble(const void *a, const void *b)
+{
+  const double da = *(const double *)a, db = *(const double *)b;
+  return da < db ? -1 : da > db ? 1 : 0;
+}
+
+static BenchResult runCase(const BenchCase *bench, int count, int frames, int warmup)
+{
+  AllocStats stats = {0, 0};
+  igSetAllocatorFunctions(benchAlloc, benchFree, &stats);
+  ImGuiContext *ctx = igCreateContext(NULL);
+  ImGuiIO *io = igGetIO();
+  io->IniFilename = NULL;
+  io->BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+
+  unsigned char *text_pixels = NULL;
+  int text_w, text_h;
+  ImFontAtlas_GetTexDataAsRGBA32(io->Fonts, &text_pixels, &text_w, &text_h, NULL);
+
+  ImGuiToggleConfig config;
+  ImGuiToggleConfig_init(&config);
+  if (bench->preset != NULL)
+    config = bench->preset();
+  ImGuiToggleStyle *style = ImGuiToggleStyle_Create(&config);
+  ImDrawList *merged_list = ImDrawList_ImDrawList(igGetDrawListSharedData());
+
+  bool *values = (bool *)calloc((size_t)count, sizeof(bool));
+  for (int i = 0; i < count; i += 3)
+    values[i] = true;
+
+  double *frame_ns = (double *)malloc((size_t)frames * sizeof(double));
+  size_t total_allocs = 0;
+  int vtx = 0, idx = 0, cmds = 0, merged_cmds = 0;
+  for (int n = 0; n < warmup + frames; n++) {
+    // large enough for every toggle to be visible, so the draw data covers all of them
+    ImVec2 display_size = {4096.0f, 4096.0f};
+    ImVec2 zero = {0.0f, 0.0f};
+    io->DisplaySize = display_size;
+    io->DeltaTime = 1.0f / 60.0f;
+
+    const size_t allocs_before = stats.allocs;
+    const double t0 = nowNs();
+    igNewFrame();
+    igSetNextWindowPos(zero, ImGuiCond_Always, zero);
+    igSetNextWindowSize(display_size, ImGuiCond_Always);
+    igBegin("bench", NULL, ImGuiWindowFlags_NoDecoration);
+    submitToggles(bench, values, count, &config, style);
+    igEnd();
+    igRender();
+    const double t1 = nowNs();
+    if (n < warmup)
+      continue;
+
+    frame_ns[n - warmup] = t1 - t0;
+    total_allocs += stats.allocs - allocs_before;
+    ImDrawData *draw_data = igGetDrawData();
+    vtx = draw_data->TotalVtxCount;
+    idx = draw_data->TotalIdxCount;
+    cmds = 0;
+    for (int l = 0; l < draw_data->CmdListsCount; l++)
+      cmds += draw_data->CmdLists.Data[l]->CmdBuffer.Size;
+    ImDrawData_MergeCmdLists(draw_data, merged_list);
+    merged_cmds = merged_list->CmdBuffer.Size;
+  }
+
+  // the median rather than the mean, so a preempted frame does not skew a run
+  qsort(frame_ns, (size_t)frames, sizeof(double), compareDouble);
+  BenchResult result;
+  result.ns_per_frame = frame_ns[frames / 2];
+  result.vtx_per_frame = vtx;
+  result.idx_per_frame = idx;
+  result.allocs_per_frame = (double)total_allocs / frames;
+  result.draw_cmds = cmds;
+  result.merged_cmds = merged_cmds;
+
+  free(frame_ns);
+  free(values);
+  ImGuiToggleStyle_Destroy(style);
+  ImDrawList_destroy(merged_list);
+  igDestroyContext(ctx);
+  return result;
+}
+
+static bool writeJson(const char *path, const BenchResult *results, int count, int frames, int warmup)
+{
+  FILE *f = fopen(path, "w");
+  if (f == NULL)
+    return false;
+  const int num_cases = (int)(sizeof(benchCases) / sizeof(benchCases[0]));
+  fprintf(f, "{\n  \"imgui\": \"%s\",\n  \"toggles\": %d,\n  \"frames\": %d,\n  \"warmup\": %d,\n  \"cases\": [\n",
+          igGetVersion(), count, frames, warmup);
+  for (int i = 0; i < num_cases; i++) {
+    const BenchResult *r = &results[i];
+    fprintf(f, "    {\"name\": \"%s\", \"ns_per_frame\": %.1f, \"vtx_per_frame\": %.0f, \"idx_per_frame\": %.0f, "
+               "\"draw_cmds\": %d, \"merged_cmds\": %d, \"allocs_per_frame\": %.2f}%s\n",
+            benchCases[i].name, r->ns_per_frame, r->vtx_per_frame, r->idx_per_frame,
+            r->draw_cmds, r->merged_cmds, r->allocs_per_frame, i + 1 < num_cases ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv)
+{
+  int count = 1000, frames = 200, warmup = 20;
+  const char *json_path = NULL;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "-n") == 0)
+      count = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-f") == 0)
+      frames = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-w") == 0)
+      warmup = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-json") == 0)
+      json_path = argv[i + 1];
+  }
+  if (count < 1 || frames < 1 || warmup < 0) {
+    fprintf(stderr, "usage: %s [-n toggles] [-f frames] [-w warmup_frames] [-json results.json]\n", argv[0]);
+    return 1;
+  }
+
+  printf("imgui v%s, %d toggles, %d frames (+%d warmup)\n", igGetVersion(), count, frames, warmup);
+  printf("%-20s %10s %12s %10s %10s %8s %8s %10s\n", "case", "ns/widget", "us/frame", "vtx/widget", "idx/widget", "cmds", "merged", "allocs/frm");
+  BenchResult results[sizeof(benchCases) / sizeof(benchCases[0])];
+  for (size_t i = 0; i < sizeof(benchCases) / sizeof(benchCases[0]); i++) {
+    const BenchResult *r = &results[i];
+    results[i] = runCase(&benchCases[i], count, frames, warmup);
+    printf("%-20s %10.1f %12.1f %10.1f %10.1f %8d %8d %10.1f\n", benchCases[i].name,
+           r->ns_per_frame / count, r->ns_per_frame / 1000.0,
+           r->vtx_per_frame / count, r->idx_per_frame / count, r->draw_cmds, r->merged_cmds, r->allocs_per_frame);
+  }
+
+  if (json_path != NULL && !writeJson(json_path, results, count, frames, warmup)) {
+    fprintf(stderr, "cannot write %s\n", json_path);
+    return 1;
+  }
+  return 0;
+}
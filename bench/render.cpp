@@ -0,0 +1,289 @@
+// OpenGL3 backend benchmark: renders a dense UI of many small windows (one draw list each) through
+// ImGui_ImplOpenGL3_RenderDrawData() into an offscreen framebuffer, on a surfaceless EGL context, so it runs headless
+// under Mesa's llvmpipe. Built once per configuration of the backend by the Makefile: render_bench (one glBufferData()
+// per draw list and GL state saved and restored, the default), render_bench_streaming (IMGUI_IMPL_OPENGL_STREAMING),
+// render_bench_owned (IMGUI_IMPL_OPENGL_OWNS_STATE) and render_bench_alpha8 (IMGUI_IMPL_OPENGL_ALPHA8_FONT).
+//
+// usage: render_bench [-w windows] [-f frames] [-ppm image.ppm] [-merge] [-font file.ttf]
+//   -merge: post-process the draw data with ImDrawData::MergeCmdLists() before rendering it
+//   -font: use that font with every glyph up to U+FFFF instead of the default one, for a font texture of a realistic size
+//
+// The checksum of the last frame's pixels is printed, and the Makefile compares the images of all variants. Frame times
+// under a software renderer are dominated by rasterization, so the GL calls the backend makes are counted as well.
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include "imgui_impl_opengl3_loader.h"  // after EGL, which brings the full khrplatform.h
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+// The few GL entry points needed on top of the ones the backend loads
+typedef void (*PFN_glGenFramebuffers)(GLsizei, GLuint*);
+typedef void (*PFN_glBindFramebuffer)(GLenum, GLuint);
+typedef void (*PFN_glGenRenderbuffers)(GLsizei, GLuint*);
+typedef void (*PFN_glBindRenderbuffer)(GLenum, GLuint);
+typedef void (*PFN_glRenderbufferStorage)(GLenum, GLenum, GLsizei, GLsizei);
+typedef void (*PFN_glFramebufferRenderbuffer)(GLenum, GLenum, GLenum, GLuint);
+typedef void (*PFN_glFinish)(void);
+
+#define BENCH_GL_FRAMEBUFFER        0x8D40
+#define BENCH_GL_RENDERBUFFER       0x8D41
+#define BENCH_GL_COLOR_ATTACHMENT0  0x8CE0
+#define BENCH_GL_RGBA8              0x8058
+
+// Calls made through the backend's loader, counted by swapping its function pointers
+struct GLCallCounts
+{
+    int Queries;        // glGetIntegerv(), glIsEnabled()
+    int Uploads;        // glBufferData(), glBufferSubData()
+    int TextureBinds;
+    int Draws;
+};
+static GLCallCounts Counts;
+static ImGL3WProcs RealProcs;
+
+static void APIENTRY countGetIntegerv(GLenum pname, GLint* data) { Counts.Queries++; RealProcs.gl.GetIntegerv(pname, data); }
+static GLboolean APIENTRY countIsEnabled(GLenum cap) { Counts.Queries++; return RealProcs.gl.IsEnabled(cap); }
+static void APIENTRY countBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) { Counts.Uploads++; RealProcs.gl.BufferData(target, size, data, usage); }
+static void APIENTRY countBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) { Counts.Uploads++; RealProcs.gl.BufferSubData(target, offset, size, data); }
+static void APIENTRY countBindTexture(GLenum target, GLuint texture) { Counts.TextureBinds++; RealProcs.gl.BindTexture(target, texture); }
+static void APIENTRY countDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) { Counts.Draws++; RealProcs.gl.DrawElements(mode, count, type, indices); }
+static void APIENTRY countDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint base_vertex) { Counts.Draws++; RealProcs.gl.DrawElementsBaseVertex(mode, count, type, indices, base_vertex); }
+
+static void installCounters()
+{
+    RealProcs = imgl3wProcs;
+    imgl3wProcs.gl.GetIntegerv = countGetIntegerv;
+    imgl3wProcs.gl.IsEnabled = countIsEnabled;
+    imgl3wProcs.gl.BufferData = countBufferData;
+    imgl3wProcs.gl.BufferSubData = countBufferSubData;
+    imgl3wProcs.gl.BindTexture = countBindTexture;
+    imgl3wProcs.gl.DrawElements = countDrawElements;
+    imgl3wProcs.gl.DrawElementsBaseVertex = countDrawElementsBaseVertex;
+}
+
+static const int FramebufferWidth = 1600;
+static const int FramebufferHeight = 1200;
+
+static double nowNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// GL 3.3 core context without any surface, rendering into a framebuffer object.
+static bool createContext()
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = get_platform_display ? get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr) : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor) || !eglBindAPI(EGL_OPENGL_API))
+        return false;
+    const EGLint config_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config;
+    EGLint num_configs = 0;
+    eglChooseConfig(display, config_attribs, &config, 1, &num_configs);
+    const EGLint context_attribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3, EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+    EGLContext context = eglCreateContext(display, num_configs > 0 ? config : (EGLConfig)0, EGL_NO_CONTEXT, context_attribs);
+    return context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+// A grid of small windows, each holding the widgets of a settings panel and overlapping the next ones. Past 256 windows
+// they stack up.
+static void submitWindows(int windows, float* values, bool* flags)
+{
+    const int columns = 16, rows = 16;
+    const ImVec2 size((float)FramebufferWidth / columns, (float)FramebufferHeight / rows);
+    for (int i = 0; i < windows; i++)
+    {
+        char title[32];
+        snprintf(title, sizeof(title), "Panel %d", i);
+        ImGui::SetNextWindowPos(ImVec2(size.x * (i % columns), size.y * ((i / columns) % rows)), ImGuiCond_Always);
+        ImGui::Begin(title, nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Text("Channel %d", i);
+        ImGui::SliderFloat("##gain", &values[i], 0.0f, 1.0f);
+        ImGui::Checkbox("Mute", &flags[i]);
+        ImGui::ProgressBar(values[i]);
+        ImGui::Button("Reset");
+        ImGui::End();
+    }
+}
+
+static int compareDouble(const void* a, const void* b)
+{
+    const double da = *(const double*)a, db = *(const double*)b;
+    return da < db ? -1 : da > db ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    int windows = 256, frames = 60;
+    const char* ppm_path = nullptr;
+    const char* font_path = nullptr;
+    bool merge = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-merge") == 0)
+            merge = true;
+        else if (i + 1 == argc)
+            break;
+        else if (strcmp(argv[i], "-w") == 0)
+            windows = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-f") == 0)
+            frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-ppm") == 0)
+            ppm_path = argv[++i];
+        else if (strcmp(argv[i], "-font") == 0)
+            font_path = argv[++i];
+    }
+    if (windows < 1 || frames < 1)
+    {
+        fprintf(stderr, "usage: %s [-w windows] [-f frames] [-ppm image.ppm] [-merge] [-font file.ttf]\n", argv[0]);
+        return 1;
+    }
+    if (!createContext())
+    {
+        fprintf(stderr, "cannot create a surfaceless EGL context with OpenGL 3.3\n");
+        return 1;
+    }
+
+#define BENCH_GL_FUNC(_NAME) PFN_##_NAME _NAME = (PFN_##_NAME)eglGetProcAddress(#_NAME)
+    BENCH_GL_FUNC(glGenFramebuffers);
+    BENCH_GL_FUNC(glBindFramebuffer);
+    BENCH_GL_FUNC(glGenRenderbuffers);
+    BENCH_GL_FUNC(glBindRenderbuffer);
+    BENCH_GL_FUNC(glRenderbufferStorage);
+    BENCH_GL_FUNC(glFramebufferRenderbuffer);
+    BENCH_GL_FUNC(glFinish);
+#undef BENCH_GL_FUNC
+    unsigned int framebuffer, renderbuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(BENCH_GL_FRAMEBUFFER, framebuffer);
+    glGenRenderbuffers(1, &renderbuffer);
+    glBindRenderbuffer(BENCH_GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorage(BENCH_GL_RENDERBUFFER, BENCH_GL_RGBA8, FramebufferWidth, FramebufferHeight);
+    glFramebufferRenderbuffer(BENCH_GL_FRAMEBUFFER, BENCH_GL_COLOR_ATTACHMENT0, BENCH_GL_RENDERBUFFER, renderbuffer);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)FramebufferWidth, (float)FramebufferHeight);
+    io.DeltaTime = 1.0f / 60.0f;
+    static const ImWchar all_ranges[] = { 0x0020, 0xFFFF, 0 };
+    if (font_path != nullptr && io.Fonts->AddFontFromFileTTF(font_path, 15.0f, nullptr, all_ranges) == nullptr)
+        return 1;
+    if (!ImGui_ImplOpenGL3_Init("#version 330 core"))
+        return 1;
+    installCounters();
+
+#ifdef IMGUI_IMPL_OPENGL_STREAMING
+    const char* upload = "streaming";
+#else
+    const char* upload = "per list";
+#endif
+#ifdef IMGUI_IMPL_OPENGL_ALPHA8_FONT
+    const char* font_format = "alpha8";
+#else
+    const char* font_format = "rgba32";
+#endif
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    const char* state = "owned";
+#else
+    const char* state = "saved";
+#endif
+    printf("imgui v%s, %s, %s uploads, GL state %s, %s, %d windows, %d frames\n", IMGUI_VERSION, (const char*)eglQueryString(eglGetCurrentDisplay(), EGL_VENDOR),
+           upload, state, merge ? "merged draw commands" : "draw lists as is", windows, frames);
+
+    float* values = (float*)malloc((size_t)windows * sizeof(float));
+    bool* flags = (bool*)malloc((size_t)windows * sizeof(bool));
+    for (int i = 0; i < windows; i++)
+    {
+        values[i] = (float)(i % 100) / 100.0f;
+        flags[i] = (i % 3) == 0;
+    }
+
+    // The submit time is the cost of the RenderDrawData() call on the CPU, the frame time includes the GPU finishing.
+    double* submit_ns = (double*)malloc((size_t)frames * sizeof(double));
+    double* frame_ns = (double*)malloc((size_t)frames * sizeof(double));
+    int draw_lists = 0, draw_cmds = 0, merged_cmds = 0;
+    ImDrawList* merged_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    GLCallCounts frame_counts = {};
+    const int warmup = 10;
+    for (int n = 0; n < warmup + frames; n++)
+    {
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui::NewFrame();
+        submitWindows(windows, values, flags);
+        ImGui::Render();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        draw_lists = draw_data->CmdListsCount;
+        draw_cmds = 0;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+            draw_cmds += draw_list->CmdBuffer.Size;
+        if (merge)
+            draw_data->MergeCmdLists(merged_list);
+        merged_cmds = 0;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+            merged_cmds += draw_list->CmdBuffer.Size;
+
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glFinish();
+        Counts = GLCallCounts();
+        const double t0 = nowNs();
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+        const double t1 = nowNs();
+        frame_counts = Counts;
+        glFinish();
+        const double t2 = nowNs();
+        if (n < warmup)
+            continue;
+        submit_ns[n - warmup] = t1 - t0;
+        frame_ns[n - warmup] = t2 - t0;
+    }
+
+    // FNV-1a of the last frame
+    unsigned char* pixels = (unsigned char*)malloc((size_t)FramebufferWidth * FramebufferHeight * 4);
+    glReadPixels(0, 0, FramebufferWidth, FramebufferHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    ImU32 checksum = 2166136261u;
+    for (size_t i = 0; i < (size_t)FramebufferWidth * FramebufferHeight * 4; i++)
+        checksum = (checksum ^ pixels[i]) * 16777619u;
+    if (ppm_path != nullptr)
+    {
+        FILE* f = fopen(ppm_path, "wb");
+        if (f == nullptr)
+        {
+            fprintf(stderr, "cannot write %s\n", ppm_path);
+            return 1;
+        }
+        fprintf(f, "P6\n%d %d\n255\n", FramebufferWidth, FramebufferHeight);
+        for (int y = FramebufferHeight - 1; y >= 0; y--)
+            for (int x = 0; x < FramebufferWidth; x++)
+                fwrite(&pixels[((size_t)y * FramebufferWidth + x) * 4], 1, 3, f);
+        fclose(f);
+    }
+
+    // medians, so a preempted frame does not skew a run
+    qsort(submit_ns, (size_t)frames, sizeof(double), compareDouble);
+    qsort(frame_ns, (size_t)frames, sizeof(double), compareDouble);
+    printf("%8s %8s %8s %8s %8s %8s %8s %12s %12s %12s\n", "lists", "cmds", "merged", "queries", "uploads", "binds", "draws", "submit us", "frame us", "pixels");
+    printf("%8d %8d %8d %8d %8d %8d %8d %12.1f %12.1f   0x%08X\n", draw_lists, draw_cmds, merged_cmds, frame_counts.Queries, frame_counts.Uploads, frame_counts.TextureBinds, frame_counts.Draws,
+           submit_ns[frames / 2] / 1000.0, frame_ns[frames / 2] / 1000.0, checksum);
+    // The atlas always keeps its Alpha8 pixels, the RGBA32 copy only exists when the backend asked for it
+    const ImFontAtlas* atlas = io.Fonts;
+    const size_t font_pixels = (size_t)atlas->TexWidth * atlas->TexHeight;
+    printf("%s font texture %dx%d: %.1f KB on the GPU, %.1f KB of atlas pixels on the CPU\n", font_format, atlas->TexWidth, atlas->TexHeight,
+           font_pixels * (atlas->TexPixelsRGBA32 != nullptr ? 4 : 1) / 1024.0, font_pixels * (atlas->TexPixelsRGBA32 != nullptr ? 5 : 1) / 1024.0);
+
+    free(pixels);
+    free(frame_ns);
+    free(submit_ns);
+    free(flags);
+    free(values);
+    IM_DELETE(merged_list);
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui::DestroyContext();
+    return 0;
+}
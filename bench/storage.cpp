@@ -0,0 +1,113 @@
+// ImGuiStorage benchmark: insert and query cost at 1k, 10k and 100k keys. Built twice by the Makefile: storage_bench
+// (pairs sorted by key, the default) and storage_bench_hashed (IMGUI_USE_HASHED_STORAGE), which changes the layout of
+// ImGuiStorage so imgui is compiled once per variant. C++ because of that: cimgui.h only knows the default layout.
+//
+// usage: storage_bench [-r repeats]
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static double nowNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Keys the way widgets produce them: the hash of a label in a window, like GetID("Toggle %d").
+static void makeKeys(ImGuiID* keys, int count, ImGuiID seed)
+{
+    for (int i = 0; i < count; i++)
+    {
+        char label[32];
+        snprintf(label, sizeof(label), "Toggle %d", i);
+        keys[i] = ImHashStr(label, 0, seed);
+    }
+}
+
+// Every key of the set, then every other one, is found with the value it was set to.
+static bool checkStorage(ImGuiStorage& storage, const ImGuiID* keys, const ImGuiID* missing, int count)
+{
+    for (int i = 0; i < count; i++)
+        if (storage.GetInt(keys[i], -1) != i || storage.GetInt(missing[i], -1) != -1)
+            return false;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    int repeats = 5;
+    for (int i = 1; i + 1 < argc; i += 2)
+        if (strcmp(argv[i], "-r") == 0)
+            repeats = atoi(argv[i + 1]);
+    if (repeats < 1)
+    {
+        fprintf(stderr, "usage: %s [-r repeats]\n", argv[0]);
+        return 1;
+    }
+
+#ifdef IMGUI_USE_HASHED_STORAGE
+    const char* backend = "hashed";
+#else
+    const char* backend = "sorted";
+#endif
+    printf("imgui v%s, %s storage, %d repeats\n", IMGUI_VERSION, backend, repeats);
+    printf("%8s %12s %12s %12s %12s %8s\n", "keys", "insert ns", "hit ns", "miss ns", "ref ns", "check");
+
+    bool all_ok = true;
+    const int counts[] = { 1000, 10000, 100000 };
+    for (int count : counts)
+    {
+        ImGuiID* keys = (ImGuiID*)malloc((size_t)count * sizeof(ImGuiID));
+        ImGuiID* missing = (ImGuiID*)malloc((size_t)count * sizeof(ImGuiID));
+        makeKeys(keys, count, ImHashStr("##window"));
+        makeKeys(missing, count, ImHashStr("##other_window"));
+
+        // first-seen IDs, as when a window with many widgets appears
+        double insert_ns = 0.0;
+        ImGuiStorage storage;
+        for (int r = 0; r < repeats; r++)
+        {
+            storage.Clear();
+            const double t0 = nowNs();
+            for (int i = 0; i < count; i++)
+                storage.SetInt(keys[i], i);
+            insert_ns += nowNs() - t0;
+        }
+
+        // per frame queries of known IDs, of unknown IDs, and Get+Set through a reference (tree nodes, toggles)
+        int sum = 0;
+        double t0 = nowNs();
+        for (int r = 0; r < repeats; r++)
+            for (int i = 0; i < count; i++)
+                sum += storage.GetInt(keys[i], 0);
+        const double hit_ns = nowNs() - t0;
+        t0 = nowNs();
+        for (int r = 0; r < repeats; r++)
+            for (int i = 0; i < count; i++)
+                sum += storage.GetInt(missing[i], 0);
+        const double miss_ns = nowNs() - t0;
+        t0 = nowNs();
+        for (int r = 0; r < repeats; r++)
+            for (int i = 0; i < count; i++)
+                sum += *storage.GetIntRef(keys[i], 0);
+        const double ref_ns = nowNs() - t0;
+
+        // queries keep working once sorted, e.g. after ImGuiSelectionBasicStorage batches
+        bool ok = checkStorage(storage, keys, missing, count);
+        storage.BuildSortByKey();
+        ok &= checkStorage(storage, keys, missing, count);
+        for (int i = 1; i < storage.Data.Size; i++)
+            ok &= storage.Data[i - 1].key < storage.Data[i].key;
+        all_ok &= ok;
+
+        const double ops = (double)count * repeats;
+        printf("%8d %12.1f %12.1f %12.1f %12.1f %8s\n", count, insert_ns / ops, hit_ns / ops, miss_ns / ops, ref_ns / ops, ok ? "ok" : "FAILED");
+        if (sum == 42)
+            printf("\n"); // keeps the queries from being optimized out
+        free(keys);
+        free(missing);
+    }
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+// Text measurement benchmark: a panel of labels that don't change, drawn every frame with Text(), Button() and word wrapped
+// TextWrapped(), and measured with CalcTextSize(). Built twice by the Makefile: text_bench (every string measured every
+// frame, the default) and text_bench_cached (IMGUI_USE_TEXT_SIZE_CACHE), which only differ in how imgui_draw.cpp is compiled.
+// The sizes of the last frame are written with -sizes, so the Makefile checks that both measure the same.
+//
+// usage: text_bench [-n labels] [-f frames] [-w warmup_frames] [-sizes sizes.bin]
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+
+enum BenchKind
+{
+    BenchKind_CalcTextSize,
+    BenchKind_Text,
+    BenchKind_Button,
+    BenchKind_TextWrapped,
+};
+
+struct BenchCase
+{
+    const char* name;
+    BenchKind   kind;
+};
+
+static const BenchCase benchCases[] =
+{
+    { "CalcTextSize",   BenchKind_CalcTextSize },
+    { "Text",           BenchKind_Text },
+    { "Button",         BenchKind_Button },
+    { "TextWrapped",    BenchKind_TextWrapped },
+};
+
+static double nowNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Labels of a settings or monitoring panel, 10 to 40 characters, a few of them with UTF-8 and with a hidden "##" part.
+static char* makeLabels(int count, int* offsets)
+{
+    static const char* const names[] = { "Temperature", "Fan speed", "Voltage (core)", "Pression d'entrée", "Enable logging", "Motor limit" };
+    char* labels = (char*)malloc((size_t)count * 64);
+    for (int i = 0; i < count; i++)
+    {
+        char* label = labels + i * 64;
+        const int len = snprintf(label, 64, "Sensor %d: %s", i, names[i % (int)(sizeof(names) / sizeof(names[0]))]);
+        if (i % 5 == 0)
+            snprintf(label + len, (size_t)(64 - len), "##row%d", i);
+        offsets[i] = i * 64;
+    }
+    return labels;
+}
+
+// Returns the median frame time and fills sizes[] with what the last frame measured.
+static double runCase(const BenchCase& bench, const char* labels, const int* offsets, int count, int frames, int warmup, ImVec2* sizes, ImU64* hits, ImU64* misses)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    double* frame_ns = (double*)malloc((size_t)frames * sizeof(double));
+    const float wrap_width = 120.0f;
+    for (int n = 0; n < warmup + frames; n++)
+    {
+        io.DisplaySize = ImVec2(4096.0f, 4096.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        const double t0 = nowNs();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("bench", NULL, ImGuiWindowFlags_NoDecoration);
+        for (int i = 0; i < count; i++)
+        {
+            const char* label = labels + offsets[i];
+            switch (bench.kind)
+            {
+            case BenchKind_CalcTextSize: sizes[i] = ImGui::CalcTextSize(label, NULL, true); break;
+            case BenchKind_Text:         ImGui::TextUnformatted(label); break;
+            case BenchKind_Button:       ImGui::PushID(i); ImGui::Button(label); ImGui::PopID(); break;
+            case BenchKind_TextWrapped:  ImGui::PushTextWrapPos(ImGui::GetCursorPosX() + wrap_width); ImGui::TextUnformatted(label); ImGui::PopTextWrapPos(); break;
+            }
+            if (bench.kind != BenchKind_CalcTextSize)
+                sizes[i] = ImGui::GetItemRectSize();
+        }
+        ImGui::End();
+        ImGui::Render();
+        const double t1 = nowNs();
+        if (n >= warmup)
+            frame_ns[n - warmup] = t1 - t0;
+    }
+
+    const ImFontTextSizeCache* cache = io.Fonts->Fonts[0]->TextSizeCache;
+    *hits = cache ? cache->Hits : 0;
+    *misses = cache ? cache->Misses : 0;
+    std::sort(frame_ns, frame_ns + frames);
+    const double median_ns = frame_ns[frames / 2];
+    free(frame_ns);
+    ImGui::DestroyContext(ctx);
+    return median_ns;
+}
+
+int main(int argc, char** argv)
+{
+    int count = 2000, frames = 100, warmup = 10;
+    const char* sizes_path = NULL;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-n") == 0)
+            count = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-f") == 0)
+            frames = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-w") == 0)
+            warmup = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-sizes") == 0)
+            sizes_path = argv[i + 1];
+    }
+    if (count < 1 || frames < 1 || warmup < 0)
+    {
+        fprintf(stderr, "usage: %s [-n labels] [-f frames] [-w warmup_frames] [-sizes sizes.bin]\n", argv[0]);
+        return 1;
+    }
+
+#ifdef IMGUI_USE_TEXT_SIZE_CACHE
+    const char* mode = "cached";
+#else
+    const char* mode = "uncached";
+#endif
+    printf("imgui v%s, %s text sizes, %d labels, %d frames (+%d warmup)\n", IMGUI_VERSION, mode, count, frames, warmup);
+    printf("%-14s %10s %12s %14s %14s\n", "case", "ns/label", "us/frame", "cache hits", "cache misses");
+
+    int* offsets = (int*)malloc((size_t)count * sizeof(int));
+    char* labels = makeLabels(count, offsets);
+    const int num_cases = (int)(sizeof(benchCases) / sizeof(benchCases[0]));
+    ImVec2* sizes = (ImVec2*)calloc((size_t)(count * num_cases), sizeof(ImVec2));
+    for (int c = 0; c < num_cases; c++)
+    {
+        ImU64 hits, misses;
+        const double frame_ns = runCase(benchCases[c], labels, offsets, count, frames, warmup, sizes + c * count, &hits, &misses);
+        printf("%-14s %10.1f %12.1f %14" IM_PRIu64 " %14" IM_PRIu64 "\n", benchCases[c].name, frame_ns / count, frame_ns / 1000.0, hits, misses);
+    }
+
+    bool ok = true;
+    if (sizes_path != NULL)
+    {
+        FILE* f = fopen(sizes_path, "wb");
+        ok = f != NULL && fwrite(sizes, sizeof(ImVec2), (size_t)(count * num_cases), f) == (size_t)(count * num_cases);
+        ok = (f != NULL && fclose(f) == 0) && ok;
+        if (!ok)
+            fprintf(stderr, "cannot write %s\n", sizes_path);
+    }
+    free(sizes);
+    free(labels);
+    free(offsets);
+    return ok ? 0 : 1;
+}
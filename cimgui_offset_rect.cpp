@@ -1,3 +1,5 @@
+// The exported definition, never the inline one.
+#undef CIMGUI_TOGGLE_INLINE
 #include "cimgui_offset_rect.h"
 
 float  ImOffsetRect_GetAverage(ImOffsetRect *self) {
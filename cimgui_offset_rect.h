@@ -20,7 +20,15 @@ struct ImOffsetRect {
 };
 
 typedef struct ImOffsetRect ImOffsetRect;
+
+#ifdef CIMGUI_TOGGLE_INLINE
+// Defined inline so the call folds into the caller, cimgui_offset_rect.cpp keeps the exported definition.
+static inline float ImOffsetRect_GetAverage(ImOffsetRect *self) {
+  return (self->Top + self->Left + self->Bottom + self->Right) / 4.0f;
+}
+#else
 float ImOffsetRect_GetAverage(ImOffsetRect *self);
+#endif
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,61 @@
-#include "imgui_toggle.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "cimgui_toggle_internal.h"
+#include "cimgui.h"
+
+// The C declarations of the config structs, kept out of the global namespace so they can be
+// compared against the ones from imgui_toggle.h. ToggleCfgPtr() relies on the two being identical.
+namespace cimgui_toggle_c {
+#define CIMGUI_TOGGLE_TYPES_ONLY
+#include "cimgui_toggle.h"
+#undef CIMGUI_TOGGLE_TYPES_ONLY
+}
+
+#define CIMGUI_TOGGLE_CHECK_SIZE(T) \
+  static_assert(sizeof(cimgui_toggle_c::T) == sizeof(::T) && alignof(cimgui_toggle_c::T) == alignof(::T), "C/C++ size mismatch: " #T)
+#define CIMGUI_TOGGLE_CHECK_FIELD(T, F) \
+  static_assert(offsetof(cimgui_toggle_c::T, F) == offsetof(::T, F), "C/C++ layout mismatch: " #T "::" #F)
+
+CIMGUI_TOGGLE_CHECK_SIZE(ImOffsetRect);
+CIMGUI_TOGGLE_CHECK_FIELD(ImOffsetRect, Top);
+CIMGUI_TOGGLE_CHECK_FIELD(ImOffsetRect, Left);
+CIMGUI_TOGGLE_CHECK_FIELD(ImOffsetRect, Bottom);
+CIMGUI_TOGGLE_CHECK_FIELD(ImOffsetRect, Right);
+
+CIMGUI_TOGGLE_CHECK_SIZE(ImGuiTogglePalette);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, Knob);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, KnobHover);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, Frame);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, FrameHover);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, FrameBorder);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, FrameShadow);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, KnobBorder);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, KnobShadow);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiTogglePalette, A11yGlyph);
+
+CIMGUI_TOGGLE_CHECK_SIZE(ImGuiToggleStateConfig);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, FrameBorderThickness);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, FrameShadowThickness);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, KnobBorderThickness);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, KnobShadowThickness);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, Label);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, KnobInset);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, KnobOffset);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleStateConfig, Palette);
+
+CIMGUI_TOGGLE_CHECK_SIZE(ImGuiToggleConfig);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, Flags);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, A11yStyle);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, AnimationDuration);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, FrameRounding);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, KnobRounding);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, WidthRatio);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, Size);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, On);
+CIMGUI_TOGGLE_CHECK_FIELD(ImGuiToggleConfig, Off);
+
+#undef CIMGUI_TOGGLE_CHECK_SIZE
+#undef CIMGUI_TOGGLE_CHECK_FIELD
 
 extern "C" {
 
@@ -7,23 +64,69 @@ bool Toggle(const char* label, bool* v, const ImVec2 size ){
 }
 
 bool ToggleFlag(const char* label, bool* v, ImGuiToggleFlags flags, const ImVec2 size){
-  return ImGui::Toggle(label, v, flags, size);
+  const bool pressed = ImGui::Toggle(label, v, flags, size);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, flags, ImGuiToggleConstants::AnimationDurationDefault);
+  return pressed;
 }
 
 bool ToggleAnim( const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, const ImVec2 size){
-  return ImGui::Toggle(label, v, flags, animation_duration, size);
+  const bool pressed = ImGui::Toggle(label, v, flags, animation_duration, size);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, flags, animation_duration);
+  return pressed;
 }
 
 bool ToggleCfg(    const char* label, bool* v, const ImGuiToggleConfig config){
-  return ImGui::Toggle(label, v, config);
+  const bool pressed = ImGui::Toggle(label, v, config);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, config.Flags, config.AnimationDuration);
+  return pressed;
+}
+
+bool ToggleCfgPtr( const char* label, bool* v, const ImGuiToggleConfig* config){
+  const bool pressed = ImGui::Toggle(label, v, *config);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, config->Flags, config->AnimationDuration);
+  return pressed;
 }
 
 bool ToggleRound(const char* label, bool* v, ImGuiToggleFlags flags, float frame_rounding, float knob_rounding, const ImVec2 size){
-  return ImGui::Toggle(label, v, flags, frame_rounding, knob_rounding, size);
+  const bool pressed = ImGui::Toggle(label, v, flags, frame_rounding, knob_rounding, size);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, flags, ImGuiToggleConstants::AnimationDurationDefault);
+  return pressed;
 }
 
 bool ToggleAnimRound(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2 size){
-  return ImGui::Toggle(label, v, flags, animation_duration, frame_rounding, knob_rounding, size);
+  const bool pressed = ImGui::Toggle(label, v, flags, animation_duration, frame_rounding, knob_rounding, size);
+  ImGuiToggleBatch::TrackToggle(label, pressed, *v, flags, animation_duration);
+  return pressed;
+}
+
+void ToggleTrackAnimation(const char* label, bool v, ImGuiToggleFlags flags, float animation_duration){
+  ImGuiToggleBatch::TrackToggle(label, true, v, flags, animation_duration);
+}
+
+bool ToggleBit32(const char* label, uint32_t* word, int bit, const ImGuiToggleConfig* config){
+  static const ImGuiToggleConfig default_config;
+  IM_ASSERT(bit >= 0 && bit < 32);
+  const uint32_t mask = (uint32_t)1 << bit;
+  bool v = (*word & mask) != 0;
+  const ImGuiToggleConfig& resolved = config != nullptr ? *config : default_config;
+  if (!ImGui::Toggle(label, &v, resolved))
+    return false;
+  ImGuiToggleBatch::TrackToggle(label, true, v, resolved.Flags, resolved.AnimationDuration);
+  *word = v ? (*word | mask) : (*word & ~mask);
+  return true;
+}
+
+bool ToggleBit64(const char* label, uint64_t* word, int bit, const ImGuiToggleConfig* config){
+  static const ImGuiToggleConfig default_config;
+  IM_ASSERT(bit >= 0 && bit < 64);
+  const uint64_t mask = (uint64_t)1 << bit;
+  bool v = (*word & mask) != 0;
+  const ImGuiToggleConfig& resolved = config != nullptr ? *config : default_config;
+  if (!ImGui::Toggle(label, &v, resolved))
+    return false;
+  ImGuiToggleBatch::TrackToggle(label, true, v, resolved.Flags, resolved.AnimationDuration);
+  *word = v ? (*word | mask) : (*word & ~mask);
+  return true;
 }
 
 /*
@@ -5,16 +5,19 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "cimgui_offset_rect.h"
 #include "cimgui_toggle_palette.h"
 
 struct ImGuiToggleConfig;
 struct ImGuiToggleStateConfig;
 struct ImGuiTogglePalette;
+struct ImGuiToggleStyle;
 
 typedef struct ImGuiToggleConfig      ImGuiToggleConfig;                   // Configuration data to fully customize a toggle.
 typedef struct ImGuiToggleStateConfig ImGuiToggleStateConfig;              // The data describing how to draw a toggle in a given state.
 typedef struct ImGuiTogglePalette     ImGuiTogglePalette;                  // Color data to adjust how a toggle is drawn.
+typedef struct ImGuiToggleStyle       ImGuiToggleStyle;                    // Opaque: a config resolved to pixels and packed colors, see ImGuiToggleStyle_Create().
 
 typedef int ImGuiToggleFlags;               // -> enum ImGuiToggleFlags_       // Flags: for Toggle() modes
 typedef int ImGuiToggleA11yStyle;           // -> enum ImGuiToggleA11yStyle_   // Describes how to draw A11y labels.
@@ -196,12 +199,108 @@ static const char* const LabelA11yOffDefault = "0";
 #endif
 
 
+#ifndef CIMGUI_TOGGLE_TYPES_ONLY
+// Called by the CIMGUI_TOGGLE_INLINE shims below when a toggle was pressed, see ToggleAnimationsActive().
+void ToggleTrackAnimation(const char* label, bool v, ImGuiToggleFlags flags, float animation_duration);
+
+#if defined(CIMGUI_TOGGLE_INLINE) && defined(__cplusplus)
+// Opt-in for C++ code using the C API: a, b, c, e and f are defined inline and call ImGui::Toggle() directly, without
+// the out-of-line wrapper or the ImVec2 copy. ImVec2 has the same name and layout whether it comes from cimgui.h or
+// imgui.h, so the declarations below resolve to the imgui_toggle functions. C code gets the same effect from LTO.
+} // extern "C"
+namespace ImGui
+{
+    bool Toggle(const char* label, bool* v, const ImVec2& size);
+    bool Toggle(const char* label, bool* v, ImGuiToggleFlags flags, const ImVec2& size);
+    bool Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, const ImVec2& size);
+    bool Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float frame_rounding, float knob_rounding, const ImVec2& size);
+    bool Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2& size);
+}
+extern "C" {
+
+/* a */ inline bool Toggle(const char* label, bool* v, const ImVec2 size){
+  return ImGui::Toggle(label, v, size);
+}
+/* b */ inline bool ToggleFlag(const char* label, bool* v, ImGuiToggleFlags flags, const ImVec2 size){
+  if (!ImGui::Toggle(label, v, flags, size))
+    return false;
+  ToggleTrackAnimation(label, *v, flags, ImGuiToggleConstants_AnimationDurationDefault);
+  return true;
+}
+/* c */ inline bool ToggleAnim(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, const ImVec2 size){
+  if (!ImGui::Toggle(label, v, flags, animation_duration, size))
+    return false;
+  ToggleTrackAnimation(label, *v, flags, animation_duration);
+  return true;
+}
+/* e */ inline bool ToggleRound(const char* label, bool* v, ImGuiToggleFlags flags, float frame_rounding, float knob_rounding, const ImVec2 size){
+  if (!ImGui::Toggle(label, v, flags, frame_rounding, knob_rounding, size))
+    return false;
+  ToggleTrackAnimation(label, *v, flags, ImGuiToggleConstants_AnimationDurationDefault);
+  return true;
+}
+/* f */ inline bool ToggleAnimRound(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2 size){
+  if (!ImGui::Toggle(label, v, flags, animation_duration, frame_rounding, knob_rounding, size))
+    return false;
+  ToggleTrackAnimation(label, *v, flags, animation_duration);
+  return true;
+}
+#else
 /* a */ bool Toggle(         const char* label, bool* v, const ImVec2 size);
 /* b */ bool ToggleFlag(     const char* label, bool* v, ImGuiToggleFlags flags, const ImVec2 size);
 /* c */ bool ToggleAnim(     const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, const ImVec2 size);
-/* d */ bool ToggleCfg(      const char* label, bool* v, const ImGuiToggleConfig config);
 /* e */ bool ToggleRound(    const char* label, bool* v, ImGuiToggleFlags flags, float frame_rounding, float knob_rounding, const ImVec2 size);
 /* f */ bool ToggleAnimRound(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2 size);
+#endif // CIMGUI_TOGGLE_INLINE
+/* d */ bool ToggleCfg(      const char* label, bool* v, const ImGuiToggleConfig config);
+
+// Same as ToggleCfg(), but the config is passed through to imgui_toggle without being copied.
+/* d */ bool ToggleCfgPtr(   const char* label, bool* v, const ImGuiToggleConfig* config);
+
+// Toggles bit `bit` of `*word` in place, the value is never unpacked into a separate bool. `bit` is 0..31 (0..63 for
+// ToggleBit64). `config` may be NULL.
+bool ToggleBit32(const char* label, uint32_t* word, int bit, const ImGuiToggleConfig* config);
+bool ToggleBit64(const char* label, uint64_t* word, int bit, const ImGuiToggleConfig* config);
+
+// ImGuiToggleStyle: a config compiled once for repeated use. Colors are resolved against the current ImGuiStyle and
+// packed the first time the style is drawn with, and again only when the theme colors, alpha or frame height change.
+// The config, including its palettes, is copied: call ImGuiToggleStyle_SetConfig() after editing it.
+ImGuiToggleStyle* ImGuiToggleStyle_Create(const ImGuiToggleConfig* config);
+void              ImGuiToggleStyle_Destroy(ImGuiToggleStyle* style);
+void              ImGuiToggleStyle_SetConfig(ImGuiToggleStyle* style, const ImGuiToggleConfig* config);
+
+// A toggle drawn with a compiled style, without any per-widget color conversion. A11y glyphs are not drawn.
+bool ToggleStyled(const char* label, bool* v, ImGuiToggleStyle* style);
+
+// Draws `count` toggles sharing one config as a single item, laid out in `columns` columns
+// (<= 0: as many as fit the available width). Layout, hit-testing and colors are resolved once for the
+// whole block and only the visible toggles are drawn. `config` may be NULL for the default style.
+// A11y glyphs are not drawn. Returns true when a value was changed.
+bool ToggleArray(      const char* str_id, bool* values,   int count, const ImGuiToggleConfig* config, int columns);
+bool ToggleArrayStyled(const char* str_id, bool* values,   int count, ImGuiToggleStyle* style, int columns);
+
+// Same as ToggleArray(), editing a packed bitset directly: bit `i` is in bits[i / 32] (or bits[i / 64]),
+// least significant bit first.
+bool ToggleArrayBits32(const char* str_id, uint32_t* bits, int count, const ImGuiToggleConfig* config, int columns);
+bool ToggleArrayBits64(const char* str_id, uint64_t* bits, int count, const ImGuiToggleConfig* config, int columns);
+
+// Same layout as ToggleArray(), but every row is its own item submitted through ImGuiListClipper, so only
+// the rows inside the visible scroll region cost anything. Meant for very large sets inside a scrolling window.
+// ToggleGridBits32() and ToggleGridBits64() use the same bit order as ToggleArrayBits32()/ToggleArrayBits64().
+// ToggleGridCallback() reads values through `getter` and writes them through `setter` (NULL: read-only).
+bool ToggleGrid(        const char* str_id, bool* values,   int count, const ImGuiToggleConfig* config, int columns);
+bool ToggleGridBits32(  const char* str_id, uint32_t* bits, int count, const ImGuiToggleConfig* config, int columns);
+bool ToggleGridBits64(  const char* str_id, uint64_t* bits, int count, const ImGuiToggleConfig* config, int columns);
+bool ToggleGridCallback(const char* str_id, int count, const ImGuiToggleConfig* config, int columns,
+                        bool (*getter)(void* user_data, int index), void (*setter)(void* user_data, int index, bool value), void* user_data);
+
+// Animated toggles flipped through any of the functions above are tracked until their knob comes to rest.
+// ToggleAnimationsActive() is true while at least one is moving, i.e. while the toggles need a redraw every frame.
+// ToggleNextDeadline() returns the igGetTime() at which the first of them comes to rest, 0.0 when none is moving.
+// Together they let the application sleep (e.g. glfwWaitEventsTimeout()) whenever no toggle is animating.
+bool   ToggleAnimationsActive(void);
+double ToggleNextDeadline(void);
+#endif // CIMGUI_TOGGLE_TYPES_ONLY
 
 
 /* a */ //IMGUI_API bool Toggle(const char* label, bool* v, const ImVec2& size = ImVec2());
@@ -0,0 +1,196 @@
+// Animation store: the few toggles whose knob is moving live in a small open addressing table keyed by toggle ID,
+// with linear probing and backward shift deletion. An animation is dropped as soon as it is finished, so the
+// per-frame cost is proportional to the toggles in motion rather than to the toggles ever drawn.
+// Each Dear ImGui context has its own store, created on first use and freed by a shutdown hook of that context.
+#include "cimgui_toggle_internal.h"
+
+namespace
+{
+    ImVector<ImGuiToggleAnimationStore*> Stores;
+    ImGuiToggleAnimationStore* LastStore = nullptr;
+}
+
+static int FindSlot(const ImGuiToggleAnimationStore& store, ImGuiID id)
+{
+    if (store.Slots.Size == 0)
+        return -1;
+    const int mask = store.Slots.Size - 1;
+    for (int slot = (int)(id & mask); ; slot = (slot + 1) & mask)
+    {
+        const int entry = store.Slots[slot];
+        if (entry == 0)
+            return -1;
+        if (store.Active[entry - 1].Id == id)
+            return slot;
+    }
+}
+
+static void InsertSlot(ImGuiToggleAnimationStore& store, ImGuiID id, int index)
+{
+    const int mask = store.Slots.Size - 1;
+    int slot = (int)(id & mask);
+    while (store.Slots[slot] != 0)
+        slot = (slot + 1) & mask;
+    store.Slots[slot] = index + 1;
+}
+
+static void Rehash(ImGuiToggleAnimationStore& store, int capacity)
+{
+    store.Slots.resize(capacity);
+    memset(store.Slots.Data, 0, (size_t)store.Slots.size_in_bytes());
+    for (int index = 0; index < store.Active.Size; index++)
+        InsertSlot(store, store.Active[index].Id, index);
+}
+
+static void Remove(ImGuiToggleAnimationStore& store, int index)
+{
+    // Backward shift deletion: entries following the freed slot in the probe sequence move up unless their home
+    // slot lies after the hole, which keeps every entry reachable without tombstones.
+    const int mask = store.Slots.Size - 1;
+    int hole = FindSlot(store, store.Active[index].Id);
+    IM_ASSERT(hole >= 0);
+    for (int slot = (hole + 1) & mask; store.Slots[slot] != 0; slot = (slot + 1) & mask)
+    {
+        const int home = (int)(store.Active[store.Slots[slot] - 1].Id & mask);
+        const bool in_place = hole <= slot ? (home > hole && home <= slot) : (home > hole || home <= slot);
+        if (in_place)
+            continue;
+        store.Slots[hole] = store.Slots[slot];
+        hole = slot;
+    }
+    store.Slots[hole] = 0;
+
+    // Keep Active dense by moving the last animation into the freed entry.
+    const int last = store.Active.Size - 1;
+    if (index != last)
+    {
+        store.Slots[FindSlot(store, store.Active[last].Id)] = index + 1;
+        store.Active[index] = store.Active[last];
+    }
+    store.Active.pop_back();
+}
+
+static float GetProgress(const ImGuiToggleAnimation& animation, double time)
+{
+    const float t = (float)(time - animation.StartTime) / animation.Duration;
+    return ImSaturate(animation.Target ? animation.From + t : animation.From - t);
+}
+
+static void ShutdownHook(ImGuiContext*, ImGuiContextHook* hook)
+{
+    ImGuiToggleAnimationStore* store = (ImGuiToggleAnimationStore*)hook->UserData;
+    Stores.find_erase_unsorted(store);
+    if (Stores.Size == 0)
+        Stores.clear(); // Not left for the static destructor, which may run after the allocator is gone
+    if (LastStore == store)
+        LastStore = nullptr;
+    IM_DELETE(store);
+}
+
+static ImGuiToggleAnimationStore& GetStore(ImGuiContext& g)
+{
+    if (LastStore != nullptr && LastStore->Context == &g)
+        return *LastStore;
+    for (ImGuiToggleAnimationStore* store : Stores)
+        if (store->Context == &g)
+            return *(LastStore = store);
+
+    ImGuiToggleAnimationStore* store = IM_NEW(ImGuiToggleAnimationStore)();
+    store->Context = &g;
+    Stores.push_back(store);
+    ImGuiContextHook hook;
+    hook.Type = ImGuiContextHookType_Shutdown;
+    hook.Callback = ShutdownHook;
+    hook.UserData = store;
+    ImGui::AddContextHook(&g, &hook);
+    return *(LastStore = store);
+}
+
+ImGuiToggleAnimationStore& ImGuiToggleBatch::GetAnimations()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiToggleAnimationStore& store = GetStore(g);
+    if (store.LastPruneFrame != g.FrameCount)
+    {
+        store.LastPruneFrame = g.FrameCount;
+        for (int index = store.Active.Size - 1; index >= 0; index--)
+        {
+            const ImGuiToggleAnimation& animation = store.Active[index];
+            if (GetProgress(animation, g.Time) == (animation.Target ? 1.0f : 0.0f))
+                Remove(store, index);
+        }
+    }
+    return store;
+}
+
+void ImGuiToggleBatch::StartAnimation(ImGuiID id, ImGuiID item_id, bool target, float duration)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiToggleAnimationStore& store = GetAnimations();
+
+    // A toggle flipped again mid-flight turns back from where its knob currently is.
+    const int slot = FindSlot(store, id);
+    if (slot >= 0)
+    {
+        ImGuiToggleAnimation& animation = store.Active[store.Slots[slot] - 1];
+        animation.From = GetProgress(animation, g.Time);
+        animation.Target = target;
+        animation.Duration = duration;
+        animation.StartTime = g.Time;
+        return;
+    }
+
+    // Kept at most half full so probe sequences stay short.
+    if ((store.Active.Size + 1) * 2 > store.Slots.Size)
+        Rehash(store, ImMax(16, store.Slots.Size * 2));
+    ImGuiToggleAnimation animation;
+    animation.Id = id;
+    animation.ItemId = item_id;
+    animation.Target = target;
+    animation.From = target ? 0.0f : 1.0f;
+    animation.Duration = duration;
+    animation.StartTime = g.Time;
+    store.Active.push_back(animation);
+    InsertSlot(store, id, store.Active.Size - 1);
+}
+
+const ImGuiToggleAnimation* ImGuiToggleBatch::FindAnimation(ImGuiID id)
+{
+    const ImGuiToggleAnimationStore& store = GetStore(*GImGui);
+    const int slot = FindSlot(store, id);
+    return slot >= 0 ? &store.Active[store.Slots[slot] - 1] : nullptr;
+}
+
+float ImGuiToggleBatch::GetAnimationProgress(const ImGuiToggleAnimation& animation)
+{
+    return GetProgress(animation, GImGui->Time);
+}
+
+void ImGuiToggleBatch::TrackToggle(const char* label, bool pressed, bool v, ImGuiToggleFlags flags, float animation_duration)
+{
+    if (pressed && (flags & ImGuiToggleFlags_Animated) && animation_duration > 0.0f)
+    {
+        const ImGuiID id = ImGui::GetID(label);
+        StartAnimation(id, id, v, animation_duration);
+    }
+}
+
+extern "C" {
+
+bool ToggleAnimationsActive(void){
+  return ImGuiToggleBatch::GetAnimations().Active.Size > 0;
+}
+
+double ToggleNextDeadline(void){
+  double deadline = 0.0;
+  for (const ImGuiToggleAnimation& animation : ImGuiToggleBatch::GetAnimations().Active)
+  {
+    const float remaining = animation.Target ? 1.0f - animation.From : animation.From;
+    const double end_time = animation.StartTime + (double)(animation.Duration * remaining);
+    if (deadline == 0.0 || end_time < deadline)
+      deadline = end_time;
+  }
+  return deadline;
+}
+
+} // extern "C"
@@ -0,0 +1,258 @@
+#include <stdint.h>
+#include "cimgui_toggle_internal.h"
+
+// Theme colors used for any palette member left at zero, same as imgui_toggle.
+static ImU32 ResolveColor(const ImGuiTogglePalette* palette, const ImVec4 ImGuiTogglePalette::*member, ImGuiCol theme_color)
+{
+    if (palette != nullptr)
+    {
+        const ImVec4& color = palette->*member;
+        if (color.x != 0.0f || color.y != 0.0f || color.z != 0.0f || color.w != 0.0f)
+            return ImGui::GetColorU32(color);
+    }
+    return ImGui::GetColorU32(theme_color);
+}
+
+static void ResolveState(ImGuiToggleResolvedState* out, const ImGuiToggleConfig& config, const ImGuiToggleStateConfig& state, ImVec2 size, bool on)
+{
+    const ImOffsetRect& inset = state.KnobInset;
+    if (config.KnobRounding >= 1.0f)
+    {
+        // A round knob uses the average inset in every direction.
+        const float average = inset.GetAverage();
+        out->KnobRect = ImRect(average, average, size.y - average, size.y - average);
+    }
+    else
+    {
+        out->KnobRect = ImRect(inset.Left, inset.Top, size.y - inset.Right, size.y - inset.Bottom);
+    }
+
+    // Positive offsets move the knob towards the inside of the frame.
+    const float travel = size.x - size.y;
+    const float offset_x = on ? travel - state.KnobOffset.x : state.KnobOffset.x;
+    out->KnobRect.Translate(ImVec2(offset_x, state.KnobOffset.y));
+    out->KnobRounding = out->KnobRect.GetHeight() * ImGuiToggleConstants::DiameterToRadiusRatio * config.KnobRounding;
+
+    out->FrameBorderThickness = state.FrameBorderThickness;
+    out->FrameShadowThickness = state.FrameShadowThickness;
+    out->KnobBorderThickness = state.KnobBorderThickness;
+    out->KnobShadowThickness = state.KnobShadowThickness;
+
+    const ImGuiTogglePalette* palette = state.Palette;
+    out->Frame       = ResolveColor(palette, &ImGuiTogglePalette::Frame,       on ? ImGuiCol_Button : ImGuiCol_FrameBg);
+    out->FrameHover  = ResolveColor(palette, &ImGuiTogglePalette::FrameHover,  on ? ImGuiCol_ButtonHovered : ImGuiCol_FrameBgHovered);
+    out->Knob        = ResolveColor(palette, &ImGuiTogglePalette::Knob,        ImGuiCol_Text);
+    out->KnobHover   = ResolveColor(palette, &ImGuiTogglePalette::KnobHover,   ImGuiCol_Text);
+    out->FrameBorder = ResolveColor(palette, &ImGuiTogglePalette::FrameBorder, ImGuiCol_Border);
+    out->FrameShadow = ResolveColor(palette, &ImGuiTogglePalette::FrameShadow, ImGuiCol_BorderShadow);
+    out->KnobBorder  = ResolveColor(palette, &ImGuiTogglePalette::KnobBorder,  ImGuiCol_Border);
+    out->KnobShadow  = ResolveColor(palette, &ImGuiTogglePalette::KnobShadow,  ImGuiCol_BorderShadow);
+}
+
+void ImGuiToggleBatch::ResolveStyle(ImGuiToggleResolvedStyle* out, const ImGuiToggleConfig& config)
+{
+    const float height = config.Size.y > 0.0f ? config.Size.y : ImGui::GetFrameHeight();
+    const float width = config.Size.x > 0.0f ? config.Size.x : height * config.WidthRatio;
+
+    out->Flags = config.Flags;
+    out->Size = ImVec2(width, height);
+    out->FrameRounding = height * ImGuiToggleConstants::DiameterToRadiusRatio * config.FrameRounding;
+    out->KnobRound = config.KnobRounding >= 1.0f;
+    out->AnimationDuration = (config.Flags & ImGuiToggleFlags_Animated) ? ImMax(config.AnimationDuration, 0.0f) : 0.0f;
+    ResolveState(&out->States[0], config, config.Off, out->Size, false);
+    ResolveState(&out->States[1], config, config.On, out->Size, true);
+}
+
+void ImGuiToggleBatch::GetColors(ImU32 out[ImGuiToggleLayer_COUNT], const ImGuiToggleResolvedState& state, bool hovered)
+{
+    out[ImGuiToggleLayer_FrameShadow] = state.FrameShadow;
+    out[ImGuiToggleLayer_Frame]       = hovered ? state.FrameHover : state.Frame;
+    out[ImGuiToggleLayer_FrameBorder] = state.FrameBorder;
+    out[ImGuiToggleLayer_KnobShadow]  = state.KnobShadow;
+    out[ImGuiToggleLayer_Knob]        = hovered ? state.KnobHover : state.Knob;
+    out[ImGuiToggleLayer_KnobBorder]  = state.KnobBorder;
+}
+
+void ImGuiToggleBatch::DrawShapes(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, bool on, const ImU32 colors[ImGuiToggleLayer_COUNT])
+{
+    const ImGuiToggleResolvedState& state = style.States[on ? 1 : 0];
+    const ImVec2 frame_max(pos.x + style.Size.x, pos.y + style.Size.y);
+
+    if ((style.Flags & ImGuiToggleFlags_ShadowedFrame) && state.FrameShadowThickness > 0.0f)
+    {
+        const float t = state.FrameShadowThickness;
+        draw_list->AddRectFilled(ImVec2(pos.x - t, pos.y - t), ImVec2(frame_max.x + t, frame_max.y + t), colors[ImGuiToggleLayer_FrameShadow], style.FrameRounding + t);
+    }
+    draw_list->AddRectFilled(pos, frame_max, colors[ImGuiToggleLayer_Frame], style.FrameRounding);
+    if ((style.Flags & ImGuiToggleFlags_BorderedFrame) && state.FrameBorderThickness > 0.0f)
+        draw_list->AddRect(pos, frame_max, colors[ImGuiToggleLayer_FrameBorder], style.FrameRounding, ImDrawFlags_None, state.FrameBorderThickness);
+
+    const ImVec2 knob_min(pos.x + state.KnobRect.Min.x, pos.y + state.KnobRect.Min.y);
+    const ImVec2 knob_max(pos.x + state.KnobRect.Max.x, pos.y + state.KnobRect.Max.y);
+    const bool shadowed = (style.Flags & ImGuiToggleFlags_ShadowedKnob) && state.KnobShadowThickness > 0.0f;
+    const bool bordered = (style.Flags & ImGuiToggleFlags_BorderedKnob) && state.KnobBorderThickness > 0.0f;
+    if (style.KnobRound)
+    {
+        const ImVec2 center((knob_min.x + knob_max.x) * 0.5f, (knob_min.y + knob_max.y) * 0.5f);
+        const float radius = (knob_max.y - knob_min.y) * ImGuiToggleConstants::DiameterToRadiusRatio;
+        if (shadowed)
+            draw_list->AddCircleFilled(center, radius + state.KnobShadowThickness, colors[ImGuiToggleLayer_KnobShadow]);
+        draw_list->AddCircleFilled(center, radius, colors[ImGuiToggleLayer_Knob]);
+        if (bordered)
+            draw_list->AddCircle(center, radius, colors[ImGuiToggleLayer_KnobBorder], 0, state.KnobBorderThickness);
+    }
+    else
+    {
+        if (shadowed)
+        {
+            const float t = state.KnobShadowThickness;
+            draw_list->AddRectFilled(ImVec2(knob_min.x - t, knob_min.y - t), ImVec2(knob_max.x + t, knob_max.y + t), colors[ImGuiToggleLayer_KnobShadow], state.KnobRounding + t);
+        }
+        draw_list->AddRectFilled(knob_min, knob_max, colors[ImGuiToggleLayer_Knob], state.KnobRounding);
+        if (bordered)
+            draw_list->AddRect(knob_min, knob_max, colors[ImGuiToggleLayer_KnobBorder], state.KnobRounding, ImDrawFlags_None, state.KnobBorderThickness);
+    }
+}
+
+void ImGuiToggleBatch::DrawToggle(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, bool on, bool hovered)
+{
+    ImU32 colors[ImGuiToggleLayer_COUNT];
+    GetColors(colors, style.States[on ? 1 : 0], hovered);
+    if (const ImGuiToggleGeometry* geometry = GetGeometry(draw_list, style, on))
+        DrawGeometry(draw_list, *geometry, pos, colors);
+    else
+        DrawShapes(draw_list, style, pos, on, colors);
+}
+
+static ImU32 LerpColor(ImU32 a, ImU32 b, float t)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= (ImU32)ImLerp((int)((a >> shift) & 0xFF), (int)((b >> shift) & 0xFF), t) << shift;
+    return out;
+}
+
+void ImGuiToggleBatch::DrawToggleAnimated(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, float progress, bool hovered)
+{
+    // Only toggles in motion come through here, blending the two states of a copy is cheap enough.
+    ImGuiToggleResolvedStyle mixed = style;
+    const ImGuiToggleResolvedState& off = style.States[0];
+    const ImGuiToggleResolvedState& on = style.States[1];
+    ImGuiToggleResolvedState& state = mixed.States[1];
+    state.KnobRect = ImRect(ImLerp(off.KnobRect.Min, on.KnobRect.Min, progress), ImLerp(off.KnobRect.Max, on.KnobRect.Max, progress));
+    state.KnobRounding = ImLerp(off.KnobRounding, on.KnobRounding, progress);
+    state.FrameBorderThickness = ImLerp(off.FrameBorderThickness, on.FrameBorderThickness, progress);
+    state.FrameShadowThickness = ImLerp(off.FrameShadowThickness, on.FrameShadowThickness, progress);
+    state.KnobBorderThickness = ImLerp(off.KnobBorderThickness, on.KnobBorderThickness, progress);
+    state.KnobShadowThickness = ImLerp(off.KnobShadowThickness, on.KnobShadowThickness, progress);
+
+    ImU32 off_colors[ImGuiToggleLayer_COUNT], colors[ImGuiToggleLayer_COUNT];
+    GetColors(off_colors, off, hovered);
+    GetColors(colors, on, hovered);
+    for (int layer = 0; layer < ImGuiToggleLayer_COUNT; layer++)
+        colors[layer] = LerpColor(off_colors[layer], colors[layer], progress);
+    DrawShapes(draw_list, mixed, pos, true, colors);
+}
+
+// Resolves `config`, or the default style when NULL, for a single call.
+static void ResolveConfig(ImGuiToggleResolvedStyle* out, const ImGuiToggleConfig* config)
+{
+    static const ImGuiToggleConfig default_config;
+    ImGuiToggleBatch::ResolveStyle(out, config != nullptr ? *config : default_config);
+}
+
+namespace
+{
+    struct BoolValues
+    {
+        bool* Values;
+        bool Get(int index) const { return Values[index]; }
+        bool Flip(int index) { Values[index] = !Values[index]; return true; }
+    };
+
+    struct CallbackValues
+    {
+        bool (*Getter)(void* user_data, int index);
+        void (*Setter)(void* user_data, int index, bool value);
+        void* UserData;
+        bool Get(int index) const { return Getter(UserData, index); }
+        bool Flip(int index)
+        {
+            // Read-only without a setter. The setter may also refuse the new value, so read it back.
+            if (Setter == nullptr)
+                return false;
+            const bool value = Getter(UserData, index);
+            Setter(UserData, index, !value);
+            return Getter(UserData, index) != value;
+        }
+    };
+
+    // Bit `index` lives in bits[index / word bits], least significant bit first.
+    template<typename T>
+    struct BitValues
+    {
+        static const int WordBits = (int)sizeof(T) * 8;
+        T* Bits;
+        bool Get(int index) const { return (Bits[index / WordBits] >> (index % WordBits)) & 1; }
+        bool Flip(int index) { Bits[index / WordBits] ^= (T)1 << (index % WordBits); return true; }
+    };
+}
+
+extern "C" {
+
+bool ToggleArray(const char* str_id, bool* values, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BoolValues accessor = { values };
+  return ImGuiToggleBatch::Block(str_id, count, columns, style, accessor);
+}
+
+bool ToggleArrayStyled(const char* str_id, bool* values, int count, ImGuiToggleStyle* style, int columns){
+  BoolValues accessor = { values };
+  return ImGuiToggleBatch::Block(str_id, count, columns, ImGuiToggleBatch::GetResolvedStyle(style), accessor);
+}
+
+bool ToggleArrayBits32(const char* str_id, uint32_t* bits, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BitValues<uint32_t> accessor = { bits };
+  return ImGuiToggleBatch::Block(str_id, count, columns, style, accessor);
+}
+
+bool ToggleArrayBits64(const char* str_id, uint64_t* bits, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BitValues<uint64_t> accessor = { bits };
+  return ImGuiToggleBatch::Block(str_id, count, columns, style, accessor);
+}
+
+bool ToggleGrid(const char* str_id, bool* values, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BoolValues accessor = { values };
+  return ImGuiToggleBatch::ClippedGrid(str_id, count, columns, style, accessor);
+}
+
+bool ToggleGridBits32(const char* str_id, uint32_t* bits, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BitValues<uint32_t> accessor = { bits };
+  return ImGuiToggleBatch::ClippedGrid(str_id, count, columns, style, accessor);
+}
+
+bool ToggleGridBits64(const char* str_id, uint64_t* bits, int count, const ImGuiToggleConfig* config, int columns){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  BitValues<uint64_t> accessor = { bits };
+  return ImGuiToggleBatch::ClippedGrid(str_id, count, columns, style, accessor);
+}
+
+bool ToggleGridCallback(const char* str_id, int count, const ImGuiToggleConfig* config, int columns,
+                        bool (*getter)(void* user_data, int index), void (*setter)(void* user_data, int index, bool value), void* user_data){
+  ImGuiToggleResolvedStyle style;
+  ResolveConfig(&style, config);
+  CallbackValues accessor = { getter, setter, user_data };
+  return ImGuiToggleBatch::ClippedGrid(str_id, count, columns, style, accessor);
+}
+
+} // extern "C"
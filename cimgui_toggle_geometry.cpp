@@ -0,0 +1,225 @@
+// Geometry cache: toggles drawn by the batched renderer share a handful of shapes, so each shape is tessellated once
+// through the regular ImDrawList path and then copied into the draw list with a translation and the real colors.
+// Each Dear ImGui context has its own cache, created on first use and freed by a shutdown hook of that context.
+#include "cimgui_toggle_internal.h"
+
+#ifndef CIMGUI_TOGGLE_DISABLE_GEOMETRY_CACHE
+
+namespace
+{
+    // Everything the tessellated output depends on. Zero-filled before use so it can be hashed and compared as bytes.
+    struct GeometryKey
+    {
+        ImVec2           Size;
+        float            FrameRounding;
+        ImGuiToggleFlags Flags;
+        int              KnobRound;
+        ImRect           KnobRect;
+        float            KnobRounding;
+        float            FrameBorderThickness;
+        float            FrameShadowThickness;
+        float            KnobBorderThickness;
+        float            KnobShadowThickness;
+        ImDrawListFlags  DrawListFlags;
+        float            CurveTessellationTol;
+        float            CircleSegmentMaxError;
+        ImVec2           TexUvWhitePixel;
+        const ImVec4*    TexUvLines;
+    };
+
+    struct GeometryEntry
+    {
+        GeometryKey         Key;
+        ImGuiToggleGeometry Geometry;
+    };
+
+    struct GeometryCache
+    {
+        ImGuiStorage            Map;        // Key hash -> GeometryEntry*
+        ImVector<GeometryEntry*> Entries;
+        GeometryEntry*          Last = nullptr;
+        ImGuiContext*           Context = nullptr;
+        int                     LastFrame = -1;
+
+        ~GeometryCache() { Clear(); }
+        void Clear()
+        {
+            for (GeometryEntry* entry : Entries)
+                IM_DELETE(entry);
+            Entries.clear();
+            Map.Clear();
+            Last = nullptr;
+        }
+    };
+
+    // Enough for every style and state of a busy application, the cache starts over when it is exceeded.
+    // Entries are only freed on the first lookup of a frame, as callers keep the geometry of both states while drawing.
+    const int GeometryCacheMaxEntries = 256;
+    ImVector<GeometryCache*> Caches;
+    GeometryCache* LastCache = nullptr;
+}
+
+static void ShutdownHook(ImGuiContext*, ImGuiContextHook* hook)
+{
+    GeometryCache* cache = (GeometryCache*)hook->UserData;
+    Caches.find_erase_unsorted(cache);
+    if (Caches.Size == 0)
+        Caches.clear(); // Not left for the static destructor, which may run after the allocator is gone
+    if (LastCache == cache)
+        LastCache = nullptr;
+    IM_DELETE(cache);
+}
+
+static GeometryCache& GetCache(ImGuiContext& g)
+{
+    if (LastCache != nullptr && LastCache->Context == &g)
+        return *LastCache;
+    for (GeometryCache* cache : Caches)
+        if (cache->Context == &g)
+            return *(LastCache = cache);
+
+    GeometryCache* cache = IM_NEW(GeometryCache)();
+    cache->Context = &g;
+    Caches.push_back(cache);
+    ImGuiContextHook hook;
+    hook.Type = ImGuiContextHookType_Shutdown;
+    hook.Callback = ShutdownHook;
+    hook.UserData = cache;
+    ImGui::AddContextHook(&g, &hook);
+    return *(LastCache = cache);
+}
+
+static void BuildKey(GeometryKey* key, const ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, bool on)
+{
+    const ImGuiToggleResolvedState& state = style.States[on ? 1 : 0];
+    const ImDrawListSharedData* data = draw_list->_Data;
+    memset((void*)key, 0, sizeof(*key));
+    key->Size = style.Size;
+    key->FrameRounding = style.FrameRounding;
+    key->Flags = style.Flags & (ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed);
+    key->KnobRound = style.KnobRound ? 1 : 0;
+    key->KnobRect = state.KnobRect;
+    key->KnobRounding = state.KnobRounding;
+    key->FrameBorderThickness = state.FrameBorderThickness;
+    key->FrameShadowThickness = state.FrameShadowThickness;
+    key->KnobBorderThickness = state.KnobBorderThickness;
+    key->KnobShadowThickness = state.KnobShadowThickness;
+    key->DrawListFlags = draw_list->Flags;
+    key->CurveTessellationTol = data->CurveTessellationTol;
+    key->CircleSegmentMaxError = data->CircleSegmentMaxError;
+    key->TexUvWhitePixel = data->TexUvWhitePixel;
+    key->TexUvLines = data->TexUvLines;
+}
+
+static void Tessellate(ImGuiToggleGeometry* out, ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, bool on)
+{
+    // Each layer gets an opaque placeholder color identifying it, fringe vertices keep the RGB and lose the alpha.
+    ImU32 layer_colors[ImGuiToggleLayer_COUNT];
+    for (int layer = 0; layer < ImGuiToggleLayer_COUNT; layer++)
+        layer_colors[layer] = ((ImU32)layer << IM_COL32_R_SHIFT) | IM_COL32_A_MASK;
+
+    ImDrawList scratch(draw_list->_Data);
+    scratch._ResetForNewFrame();
+    scratch.Flags = draw_list->Flags;
+    ImGuiToggleBatch::DrawShapes(&scratch, style, ImVec2(0.0f, 0.0f), on, layer_colors);
+    out->VtxBuffer.swap(scratch.VtxBuffer);
+    out->IdxBuffer.swap(scratch.IdxBuffer);
+
+    // Layers are emitted one after the other, split the buffers so invisible layers can be skipped when drawing.
+    int vtx_n = 0, idx_n = 0;
+    for (int layer = 0; layer < ImGuiToggleLayer_COUNT; layer++)
+    {
+        out->VtxOffsets[layer] = vtx_n;
+        out->IdxOffsets[layer] = idx_n;
+        while (vtx_n < out->VtxBuffer.Size && (int)((out->VtxBuffer[vtx_n].col >> IM_COL32_R_SHIFT) & 0xFF) == layer)
+            vtx_n++;
+        while (idx_n < out->IdxBuffer.Size && out->IdxBuffer[idx_n] < vtx_n)
+            out->IdxBuffer[idx_n++] -= (ImDrawIdx)out->VtxOffsets[layer];
+    }
+    out->VtxOffsets[ImGuiToggleLayer_COUNT] = vtx_n;
+    out->IdxOffsets[ImGuiToggleLayer_COUNT] = idx_n;
+    IM_ASSERT(vtx_n == out->VtxBuffer.Size && idx_n == out->IdxBuffer.Size);
+}
+
+const ImGuiToggleGeometry* ImGuiToggleBatch::GetGeometry(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, bool on)
+{
+    ImGuiContext& g = *GImGui;
+    GeometryCache& cache = GetCache(g);
+    if (cache.LastFrame != g.FrameCount)
+    {
+        // Entries keyed on a texture UV of an atlas since rebuilt are never looked up again, drop them all here,
+        // before any geometry of this frame is handed out.
+        cache.LastFrame = g.FrameCount;
+        if (cache.Entries.Size >= GeometryCacheMaxEntries)
+            cache.Clear();
+    }
+
+    GeometryKey key;
+    BuildKey(&key, draw_list, style, on);
+    if (cache.Last != nullptr && memcmp(&cache.Last->Key, &key, sizeof(key)) == 0)
+        return &cache.Last->Geometry;
+
+    const ImGuiID hash = ImHashData(&key, sizeof(key));
+    GeometryEntry* entry = (GeometryEntry*)cache.Map.GetVoidPtr(hash);
+    if (entry == nullptr || memcmp(&entry->Key, &key, sizeof(key)) != 0)
+    {
+        // On a hash collision the previous entry stays alive in Entries, its geometry may still be in use.
+        entry = IM_NEW(GeometryEntry)();
+        entry->Key = key;
+        Tessellate(&entry->Geometry, draw_list, style, on);
+        cache.Entries.push_back(entry);
+        cache.Map.SetVoidPtr(hash, entry);
+    }
+    cache.Last = entry;
+    return &entry->Geometry;
+}
+
+#else
+
+const ImGuiToggleGeometry* ImGuiToggleBatch::GetGeometry(ImDrawList*, const ImGuiToggleResolvedStyle&, bool)
+{
+    return nullptr;
+}
+
+#endif // CIMGUI_TOGGLE_DISABLE_GEOMETRY_CACHE
+
+void ImGuiToggleBatch::DrawGeometry(ImDrawList* draw_list, const ImGuiToggleGeometry& geometry, const ImVec2& pos, const ImU32 colors[ImGuiToggleLayer_COUNT])
+{
+    // Fully transparent layers are skipped, as ImDrawList does for shapes drawn with a zero alpha color.
+    int vtx_count = 0, idx_count = 0;
+    for (int layer = 0; layer < ImGuiToggleLayer_COUNT; layer++)
+        if (colors[layer] & IM_COL32_A_MASK)
+        {
+            vtx_count += geometry.VtxOffsets[layer + 1] - geometry.VtxOffsets[layer];
+            idx_count += geometry.IdxOffsets[layer + 1] - geometry.IdxOffsets[layer];
+        }
+    draw_list->PrimReserve(idx_count, vtx_count);
+
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_base = draw_list->_VtxCurrentIdx;
+    for (int layer = 0; layer < ImGuiToggleLayer_COUNT; layer++)
+    {
+        const ImU32 col = colors[layer];
+        if ((col & IM_COL32_A_MASK) == 0)
+            continue;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+        const ImDrawVert* vtx_begin = geometry.VtxBuffer.Data + geometry.VtxOffsets[layer];
+        const ImDrawVert* vtx_end = geometry.VtxBuffer.Data + geometry.VtxOffsets[layer + 1];
+        for (const ImDrawVert* src = vtx_begin; src < vtx_end; src++, vtx_write++)
+        {
+            vtx_write->pos = ImVec2(src->pos.x + pos.x, src->pos.y + pos.y);
+            vtx_write->uv = src->uv;
+            vtx_write->col = (src->col & IM_COL32_A_MASK) ? col : col_trans;
+        }
+        const ImDrawIdx* idx_begin = geometry.IdxBuffer.Data + geometry.IdxOffsets[layer];
+        const ImDrawIdx* idx_end = geometry.IdxBuffer.Data + geometry.IdxOffsets[layer + 1];
+        for (const ImDrawIdx* src = idx_begin; src < idx_end; src++)
+            *idx_write++ = (ImDrawIdx)(vtx_base + *src);
+        vtx_base += (unsigned int)(vtx_end - vtx_begin);
+    }
+
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_base;
+}
@@ -0,0 +1,259 @@
+// cimgui_toggle_internal.h: C++ only. The renderer behind the batched toggle entry points of cimgui_toggle.h.
+//   Instead of going through ImGui::Toggle() once per value, a whole block of toggles sharing one
+//   ImGuiToggleConfig is laid out, hit-tested and drawn as a single ImGui item.
+#pragma once
+
+#include "imgui_toggle.h"
+#include "imgui_internal.h"
+
+// The parts of an ImGuiToggleConfig that depend on the toggle's state, resolved to pixels and packed colors.
+struct ImGuiToggleResolvedState
+{
+    ImRect KnobRect;            // Knob rect, relative to the frame's top-left corner.
+    float  KnobRounding;        // Knob corner radius in pixels. Unused when the knob is round.
+    float  FrameBorderThickness;
+    float  FrameShadowThickness;
+    float  KnobBorderThickness;
+    float  KnobShadowThickness;
+    ImU32  Frame;
+    ImU32  FrameHover;
+    ImU32  Knob;
+    ImU32  KnobHover;
+    ImU32  FrameBorder;
+    ImU32  FrameShadow;
+    ImU32  KnobBorder;
+    ImU32  KnobShadow;
+};
+
+// An ImGuiToggleConfig resolved against the current style, shared by every toggle of a block.
+struct ImGuiToggleResolvedStyle
+{
+    ImGuiToggleFlags         Flags;
+    ImVec2                   Size;          // Frame size in pixels.
+    float                    FrameRounding; // Frame corner radius in pixels.
+    bool                     KnobRound;     // Knob is drawn as a circle inscribed in `KnobRect`.
+    float                    AnimationDuration; // Seconds, 0.0f when ImGuiToggleFlags_Animated is not set.
+    ImGuiToggleResolvedState States[2];     // [0]: off, [1]: on.
+};
+
+// A compiled toggle style: an ImGuiToggleConfig with its own copy of the palettes, plus the resolved style.
+// The resolved style is rebuilt only when the theme colors, alpha or frame height it was resolved against change,
+// or after the config was replaced.
+struct ImGuiToggleStyle
+{
+    ImGuiToggleConfig        Config;            // On.Palette/Off.Palette point to OnPalette/OffPalette when set.
+    ImGuiTogglePalette       OnPalette;
+    ImGuiTogglePalette       OffPalette;
+    ImGuiToggleResolvedStyle Resolved;
+    ImVec4                   ThemeColors[7];    // The theme colors `Resolved` was built from.
+    float                    Alpha;
+    float                    FrameHeight;
+    bool                     Valid;
+};
+
+// The shapes a toggle is made of, in draw order. Indexes the colors passed to the drawing functions.
+enum ImGuiToggleLayer_
+{
+    ImGuiToggleLayer_FrameShadow,
+    ImGuiToggleLayer_Frame,
+    ImGuiToggleLayer_FrameBorder,
+    ImGuiToggleLayer_KnobShadow,
+    ImGuiToggleLayer_Knob,
+    ImGuiToggleLayer_KnobBorder,
+    ImGuiToggleLayer_COUNT
+};
+
+// A toggle pre-tessellated at the origin. The red channel of each vertex color holds its ImGuiToggleLayer_,
+// a zero alpha marks an anti-aliasing fringe vertex. See cimgui_toggle_geometry.cpp.
+struct ImGuiToggleGeometry
+{
+    ImVector<ImDrawVert> VtxBuffer;
+    ImVector<ImDrawIdx>  IdxBuffer;                             // Relative to the first vertex of their layer.
+    int                  VtxOffsets[ImGuiToggleLayer_COUNT + 1];  // Layer n uses VtxBuffer[VtxOffsets[n], VtxOffsets[n + 1]).
+    int                  IdxOffsets[ImGuiToggleLayer_COUNT + 1];
+};
+
+// A toggle whose knob is moving. See cimgui_toggle_animation.cpp.
+struct ImGuiToggleAnimation
+{
+    ImGuiID Id;                 // Toggle ID: the item ID, hashed with the cell index for the toggles of a block.
+    ImGuiID ItemId;             // Item the toggle was submitted with.
+    bool    Target;             // Value the knob is moving to.
+    float   From;               // Progress when the animation started, 0.0f: off, 1.0f: on.
+    float   Duration;           // Seconds for a full off to on travel.
+    double  StartTime;
+};
+
+// Animations in flight, keyed by toggle ID with open addressing. Finished animations are removed once per frame,
+// so toggles at rest are never stored and cost nothing. One per Dear ImGui context, see cimgui_toggle_animation.cpp.
+struct ImGuiToggleAnimationStore
+{
+    ImVector<ImGuiToggleAnimation> Active;      // Dense, in no particular order.
+    ImVector<int>                  Slots;       // Index into Active + 1, 0: empty. Size is a power of two.
+    ImGuiContext*                  Context = nullptr;
+    int                            LastPruneFrame = -1;
+};
+
+namespace ImGuiToggleBatch
+{
+    void ResolveStyle(ImGuiToggleResolvedStyle* out, const ImGuiToggleConfig& config);
+    void GetColors(ImU32 out[ImGuiToggleLayer_COUNT], const ImGuiToggleResolvedState& state, bool hovered);
+    void DrawShapes(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, bool on, const ImU32 colors[ImGuiToggleLayer_COUNT]);
+    void DrawToggle(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, bool on, bool hovered);
+
+    // Returns the cached geometry of `style` in the given state for `draw_list`, tessellating it on first use.
+    // The geometry stays valid until the end of the frame.
+    // Returns NULL when the cache is compiled out with CIMGUI_TOGGLE_DISABLE_GEOMETRY_CACHE.
+    const ImGuiToggleGeometry* GetGeometry(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, bool on);
+    void DrawGeometry(ImDrawList* draw_list, const ImGuiToggleGeometry& geometry, const ImVec2& pos, const ImU32 colors[ImGuiToggleLayer_COUNT]);
+    const ImGuiToggleResolvedStyle& GetResolvedStyle(ImGuiToggleStyle* style);
+
+    // Draws a toggle part way between its off (0.0f) and on (1.0f) states.
+    void DrawToggleAnimated(ImDrawList* draw_list, const ImGuiToggleResolvedStyle& style, const ImVec2& pos, float progress, bool hovered);
+
+    inline ImGuiID GetCellId(ImGuiID item_id, int index) { return ImHashData(&index, sizeof(index), item_id); }
+    ImGuiToggleAnimationStore& GetAnimations();
+    void StartAnimation(ImGuiID id, ImGuiID item_id, bool target, float duration);
+    const ImGuiToggleAnimation* FindAnimation(ImGuiID id);
+    float GetAnimationProgress(const ImGuiToggleAnimation& animation);
+
+    // Records an animation for a toggle drawn by ImGui::Toggle() itself, so it counts towards ToggleAnimationsActive().
+    void TrackToggle(const char* label, bool pressed, bool v, ImGuiToggleFlags flags, float animation_duration);
+
+    // Submits `count` toggles, values [first, first + count), as one item of `columns` columns at the cursor.
+    // `values` must provide `bool Get(int) const` and `bool Flip(int)`, which returns false when the value didn't change.
+    template<typename T>
+    bool Cells(ImGuiID id, const ImGuiToggleResolvedStyle& style, int first, int count, int columns, T& values)
+    {
+        ImGuiContext& g = *GImGui;
+        ImGuiWindow* window = g.CurrentWindow;
+        const ImVec2 spacing = g.Style.ItemSpacing;
+        const ImVec2 pitch(style.Size.x + spacing.x, style.Size.y + spacing.y);
+        const int rows = (count + columns - 1) / columns;
+
+        const ImVec2 pos = window->DC.CursorPos;
+        const ImRect bb(pos, ImVec2(pos.x + pitch.x * columns - spacing.x, pos.y + pitch.y * rows - spacing.y));
+        ImGui::ItemSize(bb);
+        if (!ImGui::ItemAdd(bb, id))
+            return false;
+
+        // One hit-test for the whole item, the cell under the mouse is derived from its position.
+        bool hovered, held;
+        const bool pressed = ImGui::ButtonBehavior(bb, id, &hovered, &held, ImGuiButtonFlags_PressedOnClick);
+        int hovered_index = -1;
+        if (hovered)
+        {
+            const ImVec2 rel(g.IO.MousePos.x - pos.x, g.IO.MousePos.y - pos.y);
+            const int column = (int)(rel.x / pitch.x);
+            const int row = (int)(rel.y / pitch.y);
+            const int index = row * columns + column;
+            if (rel.x - column * pitch.x < style.Size.x && rel.y - row * pitch.y < style.Size.y && index < count)
+                hovered_index = index;
+        }
+
+        bool changed = false;
+        if (pressed && hovered_index >= 0 && values.Flip(first + hovered_index))
+        {
+            if (style.AnimationDuration > 0.0f)
+                StartAnimation(GetCellId(id, first + hovered_index), id, values.Get(first + hovered_index), style.AnimationDuration);
+            ImGui::MarkItemEdited(id);
+            changed = true;
+        }
+
+        // Cells of this item with a knob in motion are looked up individually, other items skip this entirely.
+        bool animating = false;
+        for (const ImGuiToggleAnimation& animation : GetAnimations().Active)
+            if (animation.ItemId == id)
+            {
+                animating = true;
+                break;
+            }
+
+        // Only the cells overlapping the clip rect are emitted, from geometry and colors looked up once.
+        ImDrawList* draw_list = window->DrawList;
+        const ImGuiToggleGeometry* geometry[2];
+        ImU32 colors[2][2][ImGuiToggleLayer_COUNT];
+        for (int on = 0; on < 2; on++)
+        {
+            geometry[on] = GetGeometry(draw_list, style, on != 0);
+            GetColors(colors[on][0], style.States[on], false);
+            GetColors(colors[on][1], style.States[on], true);
+        }
+        const ImRect& clip = window->ClipRect;
+        const int row_min = ImMax(0, (int)((clip.Min.y - pos.y) / pitch.y));
+        const int row_max = ImMin(rows, (int)((clip.Max.y - pos.y) / pitch.y) + 1);
+        const int column_min = ImMax(0, (int)((clip.Min.x - pos.x) / pitch.x));
+        const int column_max = ImMin(columns, (int)((clip.Max.x - pos.x) / pitch.x) + 1);
+        for (int row = row_min; row < row_max; row++)
+            for (int column = column_min; column < column_max; column++)
+            {
+                const int index = row * columns + column;
+                if (index >= count)
+                    break;
+                const ImVec2 cell(pos.x + column * pitch.x, pos.y + row * pitch.y);
+                if (animating)
+                    if (const ImGuiToggleAnimation* animation = FindAnimation(GetCellId(id, first + index)))
+                    {
+                        DrawToggleAnimated(draw_list, style, cell, GetAnimationProgress(*animation), index == hovered_index);
+                        continue;
+                    }
+                const int on = values.Get(first + index) ? 1 : 0;
+                const ImU32* cell_colors = colors[on][index == hovered_index ? 1 : 0];
+                if (geometry[on] != nullptr)
+                    DrawGeometry(draw_list, *geometry[on], cell, cell_colors);
+                else
+                    DrawShapes(draw_list, style, cell, on != 0, cell_colors);
+            }
+
+        return changed;
+    }
+
+    // Number of columns to use for `count` toggles, `columns` <= 0 fits as many as the available width allows.
+    inline int ResolveColumns(const ImGuiToggleResolvedStyle& style, int count, int columns)
+    {
+        if (columns <= 0)
+        {
+            const float spacing = GImGui->Style.ItemSpacing.x;
+            columns = (int)((ImGui::GetContentRegionAvail().x + spacing) / (style.Size.x + spacing));
+        }
+        return ImClamp(columns, 1, ImMax(count, 1));
+    }
+
+    // Lays out all `count` toggles as one item.
+    template<typename T>
+    bool Block(const char* str_id, int count, int columns, const ImGuiToggleResolvedStyle& style, T& values)
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        if (window->SkipItems || count <= 0)
+            return false;
+
+        columns = ResolveColumns(style, count, columns);
+        return Cells(window->GetID(str_id), style, 0, count, columns, values);
+    }
+
+    // Same layout as Block(), but each row is its own item and only the rows inside the visible
+    // scroll region are submitted, through ImGuiListClipper.
+    template<typename T>
+    bool ClippedGrid(const char* str_id, int count, int columns, const ImGuiToggleResolvedStyle& style, T& values)
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        if (window->SkipItems || count <= 0)
+            return false;
+
+        columns = ResolveColumns(style, count, columns);
+        const int rows = (count + columns - 1) / columns;
+
+        bool changed = false;
+        ImGui::PushID(str_id);
+        ImGuiListClipper clipper;
+        clipper.Begin(rows, style.Size.y + GImGui->Style.ItemSpacing.y);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                const int first = row * columns;
+                changed |= Cells(window->GetID(row), style, first, ImMin(columns, count - first), columns, values);
+            }
+        ImGui::PopID();
+        return changed;
+    }
+}
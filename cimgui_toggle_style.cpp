@@ -0,0 +1,99 @@
+#include "cimgui_toggle_internal.h"
+
+// The theme colors ImGuiToggleBatch::ResolveStyle() falls back to, in ImGuiToggleStyle::ThemeColors order.
+static const ImGuiCol ThemeColorIndices[] =
+{
+    ImGuiCol_FrameBg, ImGuiCol_FrameBgHovered, ImGuiCol_Button, ImGuiCol_ButtonHovered,
+    ImGuiCol_Text, ImGuiCol_Border, ImGuiCol_BorderShadow,
+};
+
+static void SetConfig(ImGuiToggleStyle* style, const ImGuiToggleConfig& config)
+{
+    style->Config = config;
+    if (config.On.Palette != nullptr)
+    {
+        style->OnPalette = *config.On.Palette;
+        style->Config.On.Palette = &style->OnPalette;
+    }
+    if (config.Off.Palette != nullptr)
+    {
+        style->OffPalette = *config.Off.Palette;
+        style->Config.Off.Palette = &style->OffPalette;
+    }
+    style->Valid = false;
+}
+
+const ImGuiToggleResolvedStyle& ImGuiToggleBatch::GetResolvedStyle(ImGuiToggleStyle* style)
+{
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(ThemeColorIndices) == IM_ARRAYSIZE(style->ThemeColors));
+    ImGuiContext& g = *GImGui;
+    const float frame_height = ImGui::GetFrameHeight();
+    bool valid = style->Valid && style->Alpha == g.Style.Alpha && style->FrameHeight == frame_height;
+    for (int n = 0; valid && n < IM_ARRAYSIZE(ThemeColorIndices); n++)
+        valid = memcmp(&style->ThemeColors[n], &g.Style.Colors[ThemeColorIndices[n]], sizeof(ImVec4)) == 0;
+    if (valid)
+        return style->Resolved;
+
+    ResolveStyle(&style->Resolved, style->Config);
+    for (int n = 0; n < IM_ARRAYSIZE(ThemeColorIndices); n++)
+        style->ThemeColors[n] = g.Style.Colors[ThemeColorIndices[n]];
+    style->Alpha = g.Style.Alpha;
+    style->FrameHeight = frame_height;
+    style->Valid = true;
+    return style->Resolved;
+}
+
+extern "C" {
+
+ImGuiToggleStyle* ImGuiToggleStyle_Create(const ImGuiToggleConfig* config){
+  ImGuiToggleStyle* style = IM_NEW(ImGuiToggleStyle)();
+  SetConfig(style, config != nullptr ? *config : ImGuiToggleConfig());
+  return style;
+}
+
+void ImGuiToggleStyle_Destroy(ImGuiToggleStyle* style){
+  IM_DELETE(style);
+}
+
+void ImGuiToggleStyle_SetConfig(ImGuiToggleStyle* style, const ImGuiToggleConfig* config){
+  SetConfig(style, config != nullptr ? *config : ImGuiToggleConfig());
+}
+
+bool ToggleStyled(const char* label, bool* v, ImGuiToggleStyle* style){
+  ImGuiWindow* window = ImGui::GetCurrentWindow();
+  if (window->SkipItems)
+    return false;
+
+  ImGuiContext& g = *GImGui;
+  const ImGuiToggleResolvedStyle& resolved = ImGuiToggleBatch::GetResolvedStyle(style);
+  const ImGuiID id = window->GetID(label);
+  const ImVec2 label_size = ImGui::CalcTextSize(label, nullptr, true);
+
+  const ImVec2 pos = window->DC.CursorPos;
+  const float label_width = label_size.x > 0.0f ? g.Style.ItemInnerSpacing.x + label_size.x : 0.0f;
+  const ImRect total_bb(pos, ImVec2(pos.x + resolved.Size.x + label_width, pos.y + ImMax(resolved.Size.y, label_size.y)));
+  ImGui::ItemSize(total_bb, g.Style.FramePadding.y);
+  if (!ImGui::ItemAdd(total_bb, id))
+    return false;
+
+  bool hovered, held;
+  const bool pressed = ImGui::ButtonBehavior(total_bb, id, &hovered, &held, ImGuiButtonFlags_PressedOnClick);
+  if (pressed)
+  {
+    *v = !*v;
+    if (resolved.AnimationDuration > 0.0f)
+      ImGuiToggleBatch::StartAnimation(id, id, *v, resolved.AnimationDuration);
+    ImGui::MarkItemEdited(id);
+  }
+
+  const ImGuiToggleAnimation* animation = ImGuiToggleBatch::GetAnimations().Active.Size > 0 ? ImGuiToggleBatch::FindAnimation(id) : nullptr;
+  if (animation != nullptr)
+    ImGuiToggleBatch::DrawToggleAnimated(window->DrawList, resolved, pos, ImGuiToggleBatch::GetAnimationProgress(*animation), hovered);
+  else
+    ImGuiToggleBatch::DrawToggle(window->DrawList, resolved, pos, *v, hovered);
+  if (label_size.x > 0.0f)
+    ImGui::RenderText(ImVec2(pos.x + resolved.Size.x + g.Style.ItemInnerSpacing.x, pos.y + (resolved.Size.y - label_size.y) * 0.5f), label);
+  return pressed;
+}
+
+} // extern "C"
@@ -65,6 +65,11 @@ static void imgui_toggle_simple()
 
 	// this toggle shows no label
 	Toggle("##Toggle With Hidden Label", &values[value_index++], sz);
+
+	// a block of toggles drawn as a single item, e.g. a register bit map
+	static bool bits[32] = { true, false, true };
+	igText("Toggle Array");
+	ToggleArray("##Toggle Array", bits, sizeof(bits) / sizeof(bits[0]), NULL, 8);
 }
 
 static void imgui_toggle_example() {
@@ -100,7 +105,7 @@ static void imgui_toggle_custom(void) {
   }
 
 	igNewLine();
-	ToggleCfg("Customized Toggle", &toggle_custom, config);
+	ToggleCfgPtr("Customized Toggle", &toggle_custom, &config);
 
 	igNewLine();
 
@@ -340,9 +345,20 @@ int main(int argc, char *argv[])
   clearColor.z = 0.60f;
   clearColor.w = 1.00f;
 
+  // ImGui settles some state (hover, window auto-fit) over a couple of frames after an event
+  const int settleFrames = 2;
+  int busyFrames = settleFrames;
+
   // main event loop
   while (!glfwWindowShouldClose(window)) {
-    glfwPollEvents();
+    // sleep until the next event unless a toggle is animating, toggles in motion are redrawn every frame
+    if (busyFrames > 0 || ToggleAnimationsActive()) {
+      glfwPollEvents();
+      busyFrames--;
+    } else {
+      glfwWaitEventsTimeout(0.5);
+      busyFrames = settleFrames;
+    }
 
     // start imgui frame
     ImGui_ImplOpenGL3_NewFrame();
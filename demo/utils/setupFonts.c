@@ -84,4 +84,6 @@ void setupFonts(void) {
   config->MergeMode = true;
   ImFontAtlas_AddFontFromFileTTF(pio->Fonts, IconFontPath, point2px(11), config , ranges_icon_fonts);
 #endif
+  // Only rasterize the Japanese glyphs a screen shows, the first time it shows them (needs the OpenGL3 backend of this tree)
+  pio->Fonts->Flags |= ImFontAtlasFlags_LazyGlyphs;
 }
@@ -2504,6 +2504,10 @@ CIMGUI_API void ImDrawData_ScaleClipRects(ImDrawData* self,const ImVec2 fb_scale
 {
     return self->ScaleClipRects(fb_scale);
 }
+CIMGUI_API int ImDrawData_MergeCmdLists(ImDrawData* self,ImDrawList* merged_list)
+{
+    return self->MergeCmdLists(merged_list);
+}
 CIMGUI_API ImFontConfig* ImFontConfig_ImFontConfig(void)
 {
     return IM_NEW(ImFontConfig)();
@@ -2628,6 +2632,18 @@ CIMGUI_API void ImFontAtlas_SetTexID(ImFontAtlas* self,ImTextureID id)
 {
     return self->SetTexID(id);
 }
+CIMGUI_API bool ImFontAtlas_LoadCacheFromDisk(ImFontAtlas* self,const char* filename)
+{
+    return self->LoadCacheFromDisk(filename);
+}
+CIMGUI_API bool ImFontAtlas_SaveCacheToDisk(ImFontAtlas* self,const char* filename)
+{
+    return self->SaveCacheToDisk(filename);
+}
+CIMGUI_API bool ImFontAtlas_TakeTexDirtyRect(ImFontAtlas* self,int* out_x,int* out_y,int* out_w,int* out_h)
+{
+    return self->TakeTexDirtyRect(out_x,out_y,out_w,out_h);
+}
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesDefault(ImFontAtlas* self)
 {
     return self->GetGlyphRangesDefault();
@@ -5835,6 +5851,288 @@ CIMGUI_API float igGET_FLT_MIN()
     return FLT_MIN;
 }
 
+// Bulk draw list submission: one call per array of primitives instead of one per primitive, for bindings where each
+// call across the FFI boundary costs more than the primitive itself. Items with a zero alpha color are skipped like
+// in the single primitive functions, and the geometry matches theirs. Reservations are split so that no single one
+// goes past 65536 vertices with 16-bit indices, which keeps the ImGuiBackendFlags_RendererHasVtxOffset handling
+// of PrimReserve() working.
+static inline void BulkNormalize(float& x, float& y)
+{
+    const float d2 = x * x + y * y;
+    if (d2 > 0.0f) { const float inv_len = ImRsqrt(d2); x *= inv_len; y *= inv_len; }
+}
+
+static inline void BulkFixNormal(float& x, float& y)
+{
+    const float d2 = x * x + y * y;
+    if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > 100.0f) inv_len2 = 100.0f; x *= inv_len2; y *= inv_len2; }
+}
+
+// Calls count_item(i, &idx_count, &vtx_count) for every item, which returns false for the items to skip, then
+// reserves the visible ones in as few PrimReserve() calls as the index size allows and calls write_item(i) for each.
+template<typename CountItem, typename WriteItem>
+static void BulkPrimReserve(ImDrawList* self, int count, CountItem count_item, WriteItem write_item)
+{
+    // Items go in the same draw command as with one PrimReserve() each: a new one starts where an item would not fit.
+    const bool split = sizeof(ImDrawIdx) == 2 && (self->Flags & ImDrawListFlags_AllowVtxOffset);
+    for (int begin = 0; begin < count; )
+    {
+        int idx_total = 0, vtx_total = 0, end = begin;
+        int vtx_room = split ? (1 << 16) - 1 - (int)self->_VtxCurrentIdx : INT_MAX;
+        for (; end < count; end++)
+        {
+            int idx_count, vtx_count;
+            if (!count_item(end, &idx_count, &vtx_count))
+                continue;
+            if (vtx_count > vtx_room - vtx_total)
+            {
+                if (vtx_total > 0)
+                    break;
+                vtx_room = (1 << 16) - 1; // PrimReserve() starts a new draw command for this one
+            }
+            idx_total += idx_count;
+            vtx_total += vtx_count;
+        }
+        if (vtx_total > 0)
+        {
+            self->PrimReserve(idx_total, vtx_total);
+            for (int i = begin; i < end; i++)
+            {
+                int idx_count, vtx_count;
+                if (count_item(i, &idx_count, &vtx_count))
+                    write_item(i);
+            }
+        }
+        begin = end;
+    }
+}
+
+// Writes the vertices and indices of ImDrawList::AddConvexPolyFilled() into an existing reservation.
+static void BulkPrimConvexFilled(ImDrawList* self, const ImVec2* points, int points_count, ImU32 col, ImVec2* temp_normals)
+{
+    const ImVec2 uv = self->_Data->TexUvWhitePixel;
+    ImDrawVert* vtx_write = self->_VtxWritePtr;
+    ImDrawIdx* idx_write = self->_IdxWritePtr;
+    const unsigned int vtx_inner_idx = self->_VtxCurrentIdx;
+    if (self->Flags & ImDrawListFlags_AntiAliasedFill)
+    {
+        const float AA_SIZE = self->_FringeScale;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+        const unsigned int vtx_outer_idx = vtx_inner_idx + 1;
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+            idx_write += 3;
+        }
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            BulkNormalize(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+            float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+            BulkFixNormal(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            vtx_write[0].pos.x = points[i1].x - dm_x; vtx_write[0].pos.y = points[i1].y - dm_y; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write[1].pos.x = points[i1].x + dm_x; vtx_write[1].pos.y = points[i1].y + dm_y; vtx_write[1].uv = uv; vtx_write[1].col = col_trans;
+            vtx_write += 2;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            idx_write += 6;
+        }
+        self->_VtxCurrentIdx += points_count * 2;
+    }
+    else
+    {
+        for (int i = 0; i < points_count; i++)
+        {
+            vtx_write[0].pos = points[i]; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write++;
+        }
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + i - 1); idx_write[2] = (ImDrawIdx)(vtx_inner_idx + i);
+            idx_write += 3;
+        }
+        self->_VtxCurrentIdx += points_count;
+    }
+    self->_VtxWritePtr = vtx_write;
+    self->_IdxWritePtr = idx_write;
+}
+
+static int BulkConvexIdxCount(const ImDrawList* self, int points_count)
+{
+    return (self->Flags & ImDrawListFlags_AntiAliasedFill) ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+}
+
+static int BulkConvexVtxCount(const ImDrawList* self, int points_count)
+{
+    return (self->Flags & ImDrawListFlags_AntiAliasedFill) ? points_count * 2 : points_count;
+}
+
+CIMGUI_API void ImDrawList_AddRectsFilled(ImDrawList* self, const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count)
+{
+    BulkPrimReserve(self, count,
+        [&](int i, int* idx_count, int* vtx_count) { *idx_count = 6; *vtx_count = 4; return (cols[i] & IM_COL32_A_MASK) != 0; },
+        [&](int i) { self->PrimRect(p_min[i], p_max[i], cols[i]); });
+}
+
+CIMGUI_API void ImDrawList_AddLines(ImDrawList* self, const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness)
+{
+    // The four paths of ImDrawList::AddPolyline() for an open two point line: textured, thin and thick anti-aliased, aliased.
+    const bool aa = (self->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const float AA_SIZE = self->_FringeScale;
+    const bool thick_line = thickness > AA_SIZE;
+    if (aa)
+        thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const bool use_texture = aa && (self->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX && thickness - integer_thickness <= 0.00001f && AA_SIZE == 1.0f;
+    const int idx_count = !aa || use_texture ? 6 : thick_line ? 18 : 12;
+    const int vtx_count = !aa || use_texture ? 4 : thick_line ? 8 : 6;
+    const ImVec2 opaque_uv = self->_Data->TexUvWhitePixel;
+    const ImVec4 tex_uvs = use_texture ? self->_Data->TexUvLines[integer_thickness] : ImVec4();
+
+    BulkPrimReserve(self, count,
+        [&](int i, int* idx, int* vtx) { *idx = idx_count; *vtx = vtx_count; return (cols[i] & IM_COL32_A_MASK) != 0; },
+        [&](int i)
+        {
+            const ImU32 col = cols[i];
+            const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+            const ImVec2 a(p1[i].x + 0.5f, p1[i].y + 0.5f), b(p2[i].x + 0.5f, p2[i].y + 0.5f);
+            float dx = b.x - a.x, dy = b.y - a.y;
+            BulkNormalize(dx, dy);
+            const float nx = dy, ny = -dx; // normal of the segment at the start point
+            float mx = nx, my = ny;        // and at the end point, where AddPolyline() averages the segment normals
+            BulkFixNormal(mx, my);
+            ImDrawVert* v = self->_VtxWritePtr;
+            ImDrawIdx* ix = self->_IdxWritePtr;
+            const unsigned int i1 = self->_VtxCurrentIdx;
+            if (!aa)
+            {
+                const float hx = nx * thickness * 0.5f, hy = ny * thickness * 0.5f;
+                v[0].pos = ImVec2(a.x + hx, a.y + hy); v[1].pos = ImVec2(b.x + hx, b.y + hy);
+                v[2].pos = ImVec2(b.x - hx, b.y - hy); v[3].pos = ImVec2(a.x - hx, a.y - hy);
+                for (int n = 0; n < 4; n++) { v[n].uv = opaque_uv; v[n].col = col; }
+                ix[0] = (ImDrawIdx)i1; ix[1] = (ImDrawIdx)(i1 + 1); ix[2] = (ImDrawIdx)(i1 + 2);
+                ix[3] = (ImDrawIdx)i1; ix[4] = (ImDrawIdx)(i1 + 2); ix[5] = (ImDrawIdx)(i1 + 3);
+            }
+            else if (use_texture)
+            {
+                const float half = thickness * 0.5f + 1.0f;
+                const unsigned int i2 = i1 + 2;
+                v[0].pos = ImVec2(a.x + nx * half, a.y + ny * half); v[0].uv = ImVec2(tex_uvs.x, tex_uvs.y);
+                v[1].pos = ImVec2(a.x - nx * half, a.y - ny * half); v[1].uv = ImVec2(tex_uvs.z, tex_uvs.w);
+                v[2].pos = ImVec2(b.x + mx * half, b.y + my * half); v[2].uv = ImVec2(tex_uvs.x, tex_uvs.y);
+                v[3].pos = ImVec2(b.x - mx * half, b.y - my * half); v[3].uv = ImVec2(tex_uvs.z, tex_uvs.w);
+                for (int n = 0; n < 4; n++) v[n].col = col;
+                ix[0] = (ImDrawIdx)(i2 + 0); ix[1] = (ImDrawIdx)(i1 + 0); ix[2] = (ImDrawIdx)(i1 + 1);
+                ix[3] = (ImDrawIdx)(i2 + 1); ix[4] = (ImDrawIdx)(i1 + 1); ix[5] = (ImDrawIdx)(i2 + 0);
+            }
+            else if (!thick_line)
+            {
+                const unsigned int i2 = i1 + 3;
+                const ImVec2 ends[2] = { a, b }, normals[2] = { ImVec2(nx, ny), ImVec2(mx, my) };
+                for (int e = 0; e < 2; e++, v += 3)
+                {
+                    const ImVec2 p = ends[e], n = normals[e];
+                    v[0].pos = p;                                                 v[0].col = col;
+                    v[1].pos = ImVec2(p.x + n.x * AA_SIZE, p.y + n.y * AA_SIZE); v[1].col = col_trans;
+                    v[2].pos = ImVec2(p.x - n.x * AA_SIZE, p.y - n.y * AA_SIZE); v[2].col = col_trans;
+                    v[0].uv = v[1].uv = v[2].uv = opaque_uv;
+                }
+                ix[0] = (ImDrawIdx)(i2 + 0); ix[1] = (ImDrawIdx)(i1 + 0); ix[2] = (ImDrawIdx)(i1 + 2);
+                ix[3] = (ImDrawIdx)(i1 + 2); ix[4] = (ImDrawIdx)(i2 + 2); ix[5] = (ImDrawIdx)(i2 + 0);
+                ix[6] = (ImDrawIdx)(i2 + 1); ix[7] = (ImDrawIdx)(i1 + 1); ix[8] = (ImDrawIdx)(i1 + 0);
+                ix[9] = (ImDrawIdx)(i1 + 0); ix[10] = (ImDrawIdx)(i2 + 0); ix[11] = (ImDrawIdx)(i2 + 1);
+            }
+            else
+            {
+                const float half_inner = (thickness - AA_SIZE) * 0.5f, half_outer = half_inner + AA_SIZE;
+                const unsigned int i2 = i1 + 4;
+                const ImVec2 ends[2] = { a, b }, normals[2] = { ImVec2(nx, ny), ImVec2(mx, my) };
+                for (int e = 0; e < 2; e++, v += 4)
+                {
+                    const ImVec2 p = ends[e], n = normals[e];
+                    v[0].pos = ImVec2(p.x + n.x * half_outer, p.y + n.y * half_outer); v[0].col = col_trans;
+                    v[1].pos = ImVec2(p.x + n.x * half_inner, p.y + n.y * half_inner); v[1].col = col;
+                    v[2].pos = ImVec2(p.x - n.x * half_inner, p.y - n.y * half_inner); v[2].col = col;
+                    v[3].pos = ImVec2(p.x - n.x * half_outer, p.y - n.y * half_outer); v[3].col = col_trans;
+                    v[0].uv = v[1].uv = v[2].uv = v[3].uv = opaque_uv;
+                }
+                ix[0]  = (ImDrawIdx)(i2 + 1); ix[1]  = (ImDrawIdx)(i1 + 1); ix[2]  = (ImDrawIdx)(i1 + 2);
+                ix[3]  = (ImDrawIdx)(i1 + 2); ix[4]  = (ImDrawIdx)(i2 + 2); ix[5]  = (ImDrawIdx)(i2 + 1);
+                ix[6]  = (ImDrawIdx)(i2 + 1); ix[7]  = (ImDrawIdx)(i1 + 1); ix[8]  = (ImDrawIdx)(i1 + 0);
+                ix[9]  = (ImDrawIdx)(i1 + 0); ix[10] = (ImDrawIdx)(i2 + 0); ix[11] = (ImDrawIdx)(i2 + 1);
+                ix[12] = (ImDrawIdx)(i2 + 2); ix[13] = (ImDrawIdx)(i1 + 2); ix[14] = (ImDrawIdx)(i1 + 3);
+                ix[15] = (ImDrawIdx)(i1 + 3); ix[16] = (ImDrawIdx)(i2 + 3); ix[17] = (ImDrawIdx)(i2 + 2);
+            }
+            self->_VtxWritePtr += vtx_count;
+            self->_IdxWritePtr += idx_count;
+            self->_VtxCurrentIdx += vtx_count;
+        });
+}
+
+CIMGUI_API void ImDrawList_AddCirclesFilled(ImDrawList* self, const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments)
+{
+    // num_segments <= 0 picks the count from each radius with _CalcCircleAutoSegmentCount(). The unit circle is only
+    // recomputed when the segment count changes, so runs of same sized circles share it.
+    ImVector<ImVec2>& temp = self->_Data->TempBuffer;
+    temp.reserve_discard(IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX * 3);
+    ImVec2* unit = temp.Data;
+    ImVec2* points = unit + IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX;
+    ImVec2* temp_normals = points + IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX;
+    int unit_segments = 0;
+    auto segments_of = [&](int i)
+    {
+        return num_segments > 0 ? ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX) : self->_CalcCircleAutoSegmentCount(radii[i]);
+    };
+
+    BulkPrimReserve(self, count,
+        [&](int i, int* idx_count, int* vtx_count)
+        {
+            const int segments = segments_of(i);
+            *idx_count = BulkConvexIdxCount(self, segments);
+            *vtx_count = BulkConvexVtxCount(self, segments);
+            return (cols[i] & IM_COL32_A_MASK) != 0 && radii[i] >= 0.5f;
+        },
+        [&](int i)
+        {
+            const int segments = segments_of(i);
+            if (segments != unit_segments)
+            {
+                for (int n = 0; n < segments; n++)
+                {
+                    const float a = (IM_PI * 2.0f) * (float)n / (float)segments;
+                    unit[n] = ImVec2(ImCos(a), ImSin(a));
+                }
+                unit_segments = segments;
+            }
+            for (int n = 0; n < segments; n++)
+                points[n] = ImVec2(centers[i].x + unit[n].x * radii[i], centers[i].y + unit[n].y * radii[i]);
+            BulkPrimConvexFilled(self, points, segments, cols[i], temp_normals);
+        });
+}
+
+CIMGUI_API void ImDrawList_AddQuadsFilled(ImDrawList* self, const ImVec2* points, const ImU32* cols, int count)
+{
+    // points holds 4 corners per quad, in clockwise order like ImDrawList::AddQuadFilled().
+    ImVec2 temp_normals[4];
+    BulkPrimReserve(self, count,
+        [&](int i, int* idx_count, int* vtx_count)
+        {
+            *idx_count = BulkConvexIdxCount(self, 4);
+            *vtx_count = BulkConvexVtxCount(self, 4);
+            return (cols[i] & IM_COL32_A_MASK) != 0;
+        },
+        [&](int i) { BulkPrimConvexFilled(self, points + i * 4, 4, cols[i], temp_normals); });
+}
+
 
 CIMGUI_API ImVector_ImWchar* ImVector_ImWchar_create()
 {
@@ -51,10 +51,12 @@ typedef struct ImDrawListSplitter ImDrawListSplitter;
 typedef struct ImDrawVert ImDrawVert;
 typedef struct ImFont ImFont;
 typedef struct ImFontAtlas ImFontAtlas;
+typedef struct ImFontAtlasLazyGlyphs ImFontAtlasLazyGlyphs;
 typedef struct ImFontBuilderIO ImFontBuilderIO;
 typedef struct ImFontConfig ImFontConfig;
 typedef struct ImFontGlyph ImFontGlyph;
 typedef struct ImFontGlyphRangesBuilder ImFontGlyphRangesBuilder;
+typedef struct ImFontTextSizeCache ImFontTextSizeCache;
 typedef struct ImColor ImColor;
 typedef struct ImGuiContext ImGuiContext;
 typedef struct ImGuiIO ImGuiIO;
@@ -147,10 +149,12 @@ struct ImDrawListSplitter;
 struct ImDrawVert;
 struct ImFont;
 struct ImFontAtlas;
+struct ImFontAtlasLazyGlyphs;
 struct ImFontBuilderIO;
 struct ImFontConfig;
 struct ImFontGlyph;
 struct ImFontGlyphRangesBuilder;
+struct ImFontTextSizeCache;
 struct ImColor;
 struct ImGuiContext;
 struct ImGuiIO;
@@ -687,6 +691,7 @@ typedef enum {
     ImGuiBackendFlags_HasMouseCursors = 1 << 1,
     ImGuiBackendFlags_HasSetMousePos = 1 << 2,
     ImGuiBackendFlags_RendererHasVtxOffset = 1 << 3,
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,
     ImGuiBackendFlags_PlatformHasViewports = 1 << 10,
     ImGuiBackendFlags_HasMouseHoveredViewport=1 << 11,
     ImGuiBackendFlags_RendererHasViewports = 1 << 12,
@@ -1457,6 +1462,7 @@ typedef enum {
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,
     ImFontAtlasFlags_NoMouseCursors = 1 << 1,
     ImFontAtlasFlags_NoBakedLines = 1 << 2,
+    ImFontAtlasFlags_LazyGlyphs = 1 << 3,
 }ImFontAtlasFlags_;
 typedef struct ImVector_ImFontPtr {int Size;int Capacity;ImFont** Data;} ImVector_ImFontPtr;
 
@@ -1488,6 +1494,7 @@ struct ImFontAtlas
     unsigned int FontBuilderFlags;
     int PackIdMouseCursors;
     int PackIdLines;
+    ImFontAtlasLazyGlyphs* LazyGlyphs;
 };
 typedef struct ImVector_float {int Size;int Capacity;float* Data;} ImVector_float;
 
@@ -1514,6 +1521,7 @@ struct ImFont
     float Ascent, Descent;
     int MetricsTotalSurface;
     ImU8 Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX +1)/4096/8];
+    ImFontTextSizeCache* TextSizeCache;
 };
 typedef enum {
     ImGuiViewportFlags_None = 0,
@@ -4197,6 +4205,7 @@ CIMGUI_API void ImDrawData_Clear(ImDrawData* self);
 CIMGUI_API void ImDrawData_AddDrawList(ImDrawData* self,ImDrawList* draw_list);
 CIMGUI_API void ImDrawData_DeIndexAllBuffers(ImDrawData* self);
 CIMGUI_API void ImDrawData_ScaleClipRects(ImDrawData* self,const ImVec2 fb_scale);
+CIMGUI_API int ImDrawData_MergeCmdLists(ImDrawData* self,ImDrawList* merged_list);
 CIMGUI_API ImFontConfig* ImFontConfig_ImFontConfig(void);
 CIMGUI_API void ImFontConfig_destroy(ImFontConfig* self);
 CIMGUI_API ImFontGlyphRangesBuilder* ImFontGlyphRangesBuilder_ImFontGlyphRangesBuilder(void);
@@ -4228,6 +4237,9 @@ CIMGUI_API void ImFontAtlas_GetTexDataAsAlpha8(ImFontAtlas* self,unsigned char**
 CIMGUI_API void ImFontAtlas_GetTexDataAsRGBA32(ImFontAtlas* self,unsigned char** out_pixels,int* out_width,int* out_height,int* out_bytes_per_pixel);
 CIMGUI_API bool ImFontAtlas_IsBuilt(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_SetTexID(ImFontAtlas* self,ImTextureID id);
+CIMGUI_API bool ImFontAtlas_LoadCacheFromDisk(ImFontAtlas* self,const char* filename);
+CIMGUI_API bool ImFontAtlas_SaveCacheToDisk(ImFontAtlas* self,const char* filename);
+CIMGUI_API bool ImFontAtlas_TakeTexDirtyRect(ImFontAtlas* self,int* out_x,int* out_y,int* out_w,int* out_h);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesDefault(ImFontAtlas* self);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesGreek(ImFontAtlas* self);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesKorean(ImFontAtlas* self);
@@ -5033,6 +5045,12 @@ CIMGUI_API float igGET_FLT_MAX(void);
 //for getting FLT_MIN in bindings
 CIMGUI_API float igGET_FLT_MIN(void);
 
+//bulk draw list submission, one PrimReserve for many primitives with per item colors
+CIMGUI_API void ImDrawList_AddRectsFilled(ImDrawList* self, const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count);
+CIMGUI_API void ImDrawList_AddLines(ImDrawList* self, const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness);
+CIMGUI_API void ImDrawList_AddCirclesFilled(ImDrawList* self, const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments);
+CIMGUI_API void ImDrawList_AddQuadsFilled(ImDrawList* self, const ImVec2* points, const ImU32* cols, int count);
+
 
 CIMGUI_API ImVector_ImWchar* ImVector_ImWchar_create(void);
 CIMGUI_API void ImVector_ImWchar_destroy(ImVector_ImWchar* self);
@@ -55,6 +55,12 @@ CIMGUI_API float igGET_FLT_MAX(void);
 //for getting FLT_MIN in bindings
 CIMGUI_API float igGET_FLT_MIN(void);
 
+//bulk draw list submission, one PrimReserve for many primitives with per item colors
+CIMGUI_API void ImDrawList_AddRectsFilled(ImDrawList* self, const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count);
+CIMGUI_API void ImDrawList_AddLines(ImDrawList* self, const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness);
+CIMGUI_API void ImDrawList_AddCirclesFilled(ImDrawList* self, const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments);
+CIMGUI_API void ImDrawList_AddQuadsFilled(ImDrawList* self, const ImVec2* points, const ImU32* cols, int count);
+
 
 CIMGUI_API ImVector_ImWchar* ImVector_ImWchar_create(void);
 CIMGUI_API void ImVector_ImWchar_destroy(ImVector_ImWchar* self);
@@ -1096,6 +1096,90 @@ local function ADDnonUDT(FP)
     -- end
 end
 
+--replaces all occurrences of pat, including adjacent ones sharing a delimiter
+local function gsub_repeat(str, pat, repl)
+    local n
+    repeat
+        str, n = str:gsub(pat, repl)
+    until n == 0
+    return str
+end
+local function ADDptrargs(FP)
+    local defsT = FP.defsT
+    local newcdefs = {}
+    local flagged = {}
+    local numadded = 0
+    for numcdef,t in ipairs(FP.funcdefs) do
+        newcdefs[#newcdefs+1] = t
+        if t.cimguiname then
+        local cimf = defsT[t.cimguiname]
+        local defT = cimf[t.signature]
+        --by value struct args at or over the size threshold
+        local ptrtypes = {}
+        local isPTR = false
+        if not defT.isvararg and not defT.templated and not defT.destructor and not FP.get_manuals(defT) and not FP.get_skipped(defT) then
+            for i,arg in ipairs(defT.argsT) do
+                local base = (arg.type:gsub("^const%s+",""))
+                local size = not arg.ret and FP.PTRARGS[base]
+                if size and size >= FP.PTRARGS_MIN_SIZE then
+                    ptrtypes[base] = true
+                    flagged[base] = (flagged[base] or 0) + 1
+                    isPTR = true
+                end
+            end
+        end
+        if isPTR then
+            --passing as const pointer args
+            local defT2 = {}
+            --first strings
+            for k,v in pairs(defT) do
+                defT2[k] = v
+            end
+            --then argsT, defaults, args and call_args
+            defT2.argsT = {}
+            defT2.defaults = {}
+            local args, call_args = defT.args, defT.call_args
+            for k,v in ipairs(defT.argsT) do
+                local base = (v.type:gsub("^const%s+",""))
+                if not v.ret and ptrtypes[base] then
+                    table.insert(defT2.argsT,{type="const "..base.."*",name=v.name})
+                    args = args:gsub("([%(,])"..v.type.." "..v.name.."([,%)])", "%1const "..base.."* "..v.name.."%2")
+                    call_args = call_args:gsub("([%(,])"..v.name.."([,%)])", "%1*"..v.name.."%2")
+                else
+                    table.insert(defT2.argsT,{type=v.type,name=v.name,ret=v.ret,signature=v.signature})
+                    defT2.defaults[v.name] = defT.defaults and defT.defaults[v.name]
+                end
+            end
+            defT2.args = args
+            defT2.call_args = call_args
+            local signature = defT.signature
+            for base in pairs(ptrtypes) do
+                signature = gsub_repeat(signature, "([%(,])const "..base.."([,%)])", "%1const "..base.."*%2")
+                signature = gsub_repeat(signature, "([%(,])"..base.."([,%)])", "%1const "..base.."*%2")
+            end
+            defT2.signature = signature
+            defT2.ov_cimguiname = (defT.ov_cimguiname or defT.cimguiname).."_Ptr"
+            defT2.isPTRARGS = 1
+            --check there is not an equal version already
+            if cimf[signature] then
+                print("skip _Ptr addition",defT2.ov_cimguiname)
+            else
+                cimf[#cimf+1] = defT2
+                cimf[signature] = defT2
+                newcdefs[#newcdefs+1] = {stname=t.stname,funcname=t.funcname,args=defT2.args,signature=signature,cimguiname=t.cimguiname,ret=defT2.ret}
+                numadded = numadded + 1
+            end
+        end
+        end
+    end
+    FP.funcdefs = newcdefs
+    --report the flagged structs
+    print(string.format("ptrargs: %d _Ptr variants for structs of %d bytes or more",numadded,FP.PTRARGS_MIN_SIZE))
+    M.table_do_sorted(flagged, function(k,v)
+        print(string.format("ptrargs: %s (%d bytes) passed by value %d times",k,FP.PTRARGS[k],v))
+    end)
+end
+
 local function ADDdestructors(FP)
     local defsT = FP.defsT
     local newcdefs = {}
@@ -2115,6 +2199,7 @@ function M.Parser()
 		--ADDIMSTR_S(self)
 		AdjustArguments(self)
 		ADDnonUDT(self)
+		if self.PTRARGS then ADDptrargs(self) end
 
 		--ADDdestructors(self)
         self.overloadstxt  = table.concat(strt,"\n")
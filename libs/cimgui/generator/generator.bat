@@ -17,6 +17,8 @@ set PATH=%PATH%;C:\anima;C:\mingws\i686-7.2.0-release-posix-dwarf-rt_v5-rev1\min
 :: arg[1] compiler name gcc, clang or cl
 :: arg[2] options as words in one string: internal for imgui_internal generation, comments for comments generation, nochar to skip char* function version, noimstrv to skip imstrv
 :: "constructors" adds the _Construct version of constructors
+:: "ptrargs" adds a _Ptr version taking const T* for functions taking ImVec2, ImVec4, ImRect or ImColor by value
+:: (set PTRARGS_MIN_SIZE to the smallest struct size in bytes to consider, default 8)
 :: examples: "" "internal" "internal comments"
 :: arg[3..n] name of implementations to generate and/or CFLAGS (e.g. -DIMGUI_USER_CONFIG)
 ::-DIMGUI_USE_WCHAR32 should not be used (is discarded)
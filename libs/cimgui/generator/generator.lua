@@ -12,6 +12,8 @@ local COMMENTS_GENERATION = script_args[2]:match("comments") and true or false
 local CONSTRUCTORS_GENERATION = script_args[2]:match("constructors") and true or false
 local NOCHAR = script_args[2]:match("nochar") and true or false
 local NOIMSTRV = script_args[2]:match("noimstrv") and true or false
+local PTRARGS = script_args[2]:match("ptrargs") and true or false
+local PTRARGS_MIN_SIZE = tonumber(os.getenv"PTRARGS_MIN_SIZE" or "8")
 local IMGUI_PATH = os.getenv"IMGUI_PATH" or "../imgui"
 local CFLAGS = ""
 local CPRE,CTEST
@@ -72,6 +74,7 @@ print("INTERNAL_GENERATION",INTERNAL_GENERATION)
 print("FREETYPE_GENERATION",FREETYPE_GENERATION)
 print("COMMENTS_GENERATION",COMMENTS_GENERATION)
 print("CONSTRUCTORS_GENERATION",CONSTRUCTORS_GENERATION)
+print("PTRARGS",PTRARGS,PTRARGS_MIN_SIZE)
 print("CPRE",CPRE)
 --------------------------------------------------------------------------
 --this table has the functions to be skipped in generation
@@ -355,6 +358,17 @@ local function header_text_insert(self, outtab, txt, it)
 	end
 end
 
+--------------------------------------------------------------------------
+--sizes in bytes of the structs passed by value, for the ptrargs option:
+--functions taking one of these at or over PTRARGS_MIN_SIZE also get a _Ptr variant taking const T*
+--------------------------------------------------------------------------
+local ptrargs_sizes = {
+    ImVec2 = 8,
+    ImVec4 = 16,
+    ImRect = 16,
+    ImColor = 16,
+}
+
 --funtion for parsing imgui headers
 local function parseImGuiHeader(header,names)
 	--prepare parser
@@ -374,6 +388,8 @@ local function parseImGuiHeader(header,names)
 	parser.CONSTRUCTORS_GENERATION = CONSTRUCTORS_GENERATION
 	parser.NOCHAR = NOCHAR
 	parser.NOIMSTRV = NOIMSTRV
+	parser.PTRARGS = PTRARGS and ptrargs_sizes or nil
+	parser.PTRARGS_MIN_SIZE = PTRARGS_MIN_SIZE
 	parser.custom_function_post = custom_function_post
 	parser.header_text_insert = header_text_insert
 	local defines = parser:take_lines(CPRE..header,names,COMPILER)
@@ -15,6 +15,8 @@
 # arg[1] compiler name gcc, clang, or cl
 # arg[2] options as words in one string: internal for imgui_internal generation, comments for comments generation, nochar to skip char* function version, noimstrv to skip imstrv
 # "constructors" adds the _Construct version of constructors
+# "ptrargs" adds a _Ptr version taking const T* for functions taking ImVec2, ImVec4, ImRect or ImColor by value
+# (set PTRARGS_MIN_SIZE to the smallest struct size in bytes to consider, default 8)
 # examples: "" "internal" "comments internal"
 # arg[3..n] name of implementations to generate and/or CLFLAGS (e.g. -DIMGUI_USER_CONFIG)
 # -DIMGUI_USE_WCHAR32 should not be used as it is generated for both ImWchar
@@ -830,6 +830,27 @@ defs["ImDrawData_ImDrawData"][1]["ov_cimguiname"] = "ImDrawData_ImDrawData"
 defs["ImDrawData_ImDrawData"][1]["signature"] = "()"
 defs["ImDrawData_ImDrawData"][1]["stname"] = "ImDrawData"
 defs["ImDrawData_ImDrawData"]["()"] = defs["ImDrawData_ImDrawData"][1]
+defs["ImDrawData_MergeCmdLists"] = {}
+defs["ImDrawData_MergeCmdLists"][1] = {}
+defs["ImDrawData_MergeCmdLists"][1]["args"] = "(ImDrawData* self,ImDrawList* merged_list)"
+defs["ImDrawData_MergeCmdLists"][1]["argsT"] = {}
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][1] = {}
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][1]["name"] = "self"
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][1]["type"] = "ImDrawData*"
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][2] = {}
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][2]["name"] = "merged_list"
+defs["ImDrawData_MergeCmdLists"][1]["argsT"][2]["type"] = "ImDrawList*"
+defs["ImDrawData_MergeCmdLists"][1]["argsoriginal"] = "(ImDrawList* merged_list)"
+defs["ImDrawData_MergeCmdLists"][1]["call_args"] = "(merged_list)"
+defs["ImDrawData_MergeCmdLists"][1]["cimguiname"] = "ImDrawData_MergeCmdLists"
+defs["ImDrawData_MergeCmdLists"][1]["defaults"] = {}
+defs["ImDrawData_MergeCmdLists"][1]["funcname"] = "MergeCmdLists"
+defs["ImDrawData_MergeCmdLists"][1]["location"] = "imgui:3337"
+defs["ImDrawData_MergeCmdLists"][1]["ov_cimguiname"] = "ImDrawData_MergeCmdLists"
+defs["ImDrawData_MergeCmdLists"][1]["ret"] = "int"
+defs["ImDrawData_MergeCmdLists"][1]["signature"] = "(ImDrawList*)"
+defs["ImDrawData_MergeCmdLists"][1]["stname"] = "ImDrawData"
+defs["ImDrawData_MergeCmdLists"]["(ImDrawList*)"] = defs["ImDrawData_MergeCmdLists"][1]
 defs["ImDrawData_ScaleClipRects"] = {}
 defs["ImDrawData_ScaleClipRects"][1] = {}
 defs["ImDrawData_ScaleClipRects"][1]["args"] = "(ImDrawData* self,const ImVec2 fb_scale)"
@@ -3720,6 +3741,48 @@ defs["ImFontAtlas_IsBuilt"][1]["ret"] = "bool"
 defs["ImFontAtlas_IsBuilt"][1]["signature"] = "()const"
 defs["ImFontAtlas_IsBuilt"][1]["stname"] = "ImFontAtlas"
 defs["ImFontAtlas_IsBuilt"]["()const"] = defs["ImFontAtlas_IsBuilt"][1]
+defs["ImFontAtlas_LoadCacheFromDisk"] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["args"] = "(ImFontAtlas* self,const char* filename)"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][1] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][1]["name"] = "self"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][1]["type"] = "ImFontAtlas*"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][2] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][2]["name"] = "filename"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsT"][2]["type"] = "const char*"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["argsoriginal"] = "(const char* filename)"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["call_args"] = "(filename)"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["cimguiname"] = "ImFontAtlas_LoadCacheFromDisk"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["defaults"] = {}
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["funcname"] = "LoadCacheFromDisk"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["location"] = "imgui:3471"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["ov_cimguiname"] = "ImFontAtlas_LoadCacheFromDisk"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["ret"] = "bool"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["signature"] = "(const char*)"
+defs["ImFontAtlas_LoadCacheFromDisk"][1]["stname"] = "ImFontAtlas"
+defs["ImFontAtlas_LoadCacheFromDisk"]["(const char*)"] = defs["ImFontAtlas_LoadCacheFromDisk"][1]
+defs["ImFontAtlas_SaveCacheToDisk"] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1]["args"] = "(ImFontAtlas* self,const char* filename)"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][1] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][1]["name"] = "self"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][1]["type"] = "ImFontAtlas*"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][2] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][2]["name"] = "filename"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsT"][2]["type"] = "const char*"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["argsoriginal"] = "(const char* filename)"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["call_args"] = "(filename)"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["cimguiname"] = "ImFontAtlas_SaveCacheToDisk"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["defaults"] = {}
+defs["ImFontAtlas_SaveCacheToDisk"][1]["funcname"] = "SaveCacheToDisk"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["location"] = "imgui:3472"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["ov_cimguiname"] = "ImFontAtlas_SaveCacheToDisk"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["ret"] = "bool"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["signature"] = "(const char*)"
+defs["ImFontAtlas_SaveCacheToDisk"][1]["stname"] = "ImFontAtlas"
+defs["ImFontAtlas_SaveCacheToDisk"]["(const char*)"] = defs["ImFontAtlas_SaveCacheToDisk"][1]
 defs["ImFontAtlas_SetTexID"] = {}
 defs["ImFontAtlas_SetTexID"][1] = {}
 defs["ImFontAtlas_SetTexID"][1]["args"] = "(ImFontAtlas* self,ImTextureID id)"
@@ -3741,6 +3804,36 @@ defs["ImFontAtlas_SetTexID"][1]["ret"] = "void"
 defs["ImFontAtlas_SetTexID"][1]["signature"] = "(ImTextureID)"
 defs["ImFontAtlas_SetTexID"][1]["stname"] = "ImFontAtlas"
 defs["ImFontAtlas_SetTexID"]["(ImTextureID)"] = defs["ImFontAtlas_SetTexID"][1]
+defs["ImFontAtlas_TakeTexDirtyRect"] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["args"] = "(ImFontAtlas* self,int* out_x,int* out_y,int* out_w,int* out_h)"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][1] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][1]["name"] = "self"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][1]["type"] = "ImFontAtlas*"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][2] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][2]["name"] = "out_x"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][2]["type"] = "int*"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][3] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][3]["name"] = "out_y"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][3]["type"] = "int*"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][4] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][4]["name"] = "out_w"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][4]["type"] = "int*"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][5] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][5]["name"] = "out_h"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsT"][5]["type"] = "int*"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["argsoriginal"] = "(int* out_x,int* out_y,int* out_w,int* out_h)"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["call_args"] = "(out_x,out_y,out_w,out_h)"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["cimguiname"] = "ImFontAtlas_TakeTexDirtyRect"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["defaults"] = {}
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["funcname"] = "TakeTexDirtyRect"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["location"] = "imgui:3478"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["ov_cimguiname"] = "ImFontAtlas_TakeTexDirtyRect"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["ret"] = "bool"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["signature"] = "(int*,int*,int*,int*)"
+defs["ImFontAtlas_TakeTexDirtyRect"][1]["stname"] = "ImFontAtlas"
+defs["ImFontAtlas_TakeTexDirtyRect"]["(int*,int*,int*,int*)"] = defs["ImFontAtlas_TakeTexDirtyRect"][1]
 defs["ImFontAtlas_destroy"] = {}
 defs["ImFontAtlas_destroy"][1] = {}
 defs["ImFontAtlas_destroy"][1]["args"] = "(ImFontAtlas* self)"
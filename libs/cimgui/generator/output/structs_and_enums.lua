@@ -95,6 +95,10 @@ defs["enums"]["ImFontAtlasFlags_"][4] = {}
 defs["enums"]["ImFontAtlasFlags_"][4]["calc_value"] = 4
 defs["enums"]["ImFontAtlasFlags_"][4]["name"] = "ImFontAtlasFlags_NoBakedLines"
 defs["enums"]["ImFontAtlasFlags_"][4]["value"] = "1 << 2"
+defs["enums"]["ImFontAtlasFlags_"][5] = {}
+defs["enums"]["ImFontAtlasFlags_"][5]["calc_value"] = 8
+defs["enums"]["ImFontAtlasFlags_"][5]["name"] = "ImFontAtlasFlags_LazyGlyphs"
+defs["enums"]["ImFontAtlasFlags_"][5]["value"] = "1 << 3"
 defs["enums"]["ImGuiActivateFlags_"] = {}
 defs["enums"]["ImGuiActivateFlags_"][1] = {}
 defs["enums"]["ImGuiActivateFlags_"][1]["calc_value"] = 0
@@ -155,17 +159,21 @@ defs["enums"]["ImGuiBackendFlags_"][5]["calc_value"] = 8
 defs["enums"]["ImGuiBackendFlags_"][5]["name"] = "ImGuiBackendFlags_RendererHasVtxOffset"
 defs["enums"]["ImGuiBackendFlags_"][5]["value"] = "1 << 3"
 defs["enums"]["ImGuiBackendFlags_"][6] = {}
-defs["enums"]["ImGuiBackendFlags_"][6]["calc_value"] = 1024
-defs["enums"]["ImGuiBackendFlags_"][6]["name"] = "ImGuiBackendFlags_PlatformHasViewports"
-defs["enums"]["ImGuiBackendFlags_"][6]["value"] = "1 << 10"
+defs["enums"]["ImGuiBackendFlags_"][6]["calc_value"] = 16
+defs["enums"]["ImGuiBackendFlags_"][6]["name"] = "ImGuiBackendFlags_RendererHasTexUpdates"
+defs["enums"]["ImGuiBackendFlags_"][6]["value"] = "1 << 4"
 defs["enums"]["ImGuiBackendFlags_"][7] = {}
-defs["enums"]["ImGuiBackendFlags_"][7]["calc_value"] = 2048
-defs["enums"]["ImGuiBackendFlags_"][7]["name"] = "ImGuiBackendFlags_HasMouseHoveredViewport"
-defs["enums"]["ImGuiBackendFlags_"][7]["value"] = "1 << 11"
+defs["enums"]["ImGuiBackendFlags_"][7]["calc_value"] = 1024
+defs["enums"]["ImGuiBackendFlags_"][7]["name"] = "ImGuiBackendFlags_PlatformHasViewports"
+defs["enums"]["ImGuiBackendFlags_"][7]["value"] = "1 << 10"
 defs["enums"]["ImGuiBackendFlags_"][8] = {}
-defs["enums"]["ImGuiBackendFlags_"][8]["calc_value"] = 4096
-defs["enums"]["ImGuiBackendFlags_"][8]["name"] = "ImGuiBackendFlags_RendererHasViewports"
-defs["enums"]["ImGuiBackendFlags_"][8]["value"] = "1 << 12"
+defs["enums"]["ImGuiBackendFlags_"][8]["calc_value"] = 2048
+defs["enums"]["ImGuiBackendFlags_"][8]["name"] = "ImGuiBackendFlags_HasMouseHoveredViewport"
+defs["enums"]["ImGuiBackendFlags_"][8]["value"] = "1 << 11"
+defs["enums"]["ImGuiBackendFlags_"][9] = {}
+defs["enums"]["ImGuiBackendFlags_"][9]["calc_value"] = 4096
+defs["enums"]["ImGuiBackendFlags_"][9]["name"] = "ImGuiBackendFlags_RendererHasViewports"
+defs["enums"]["ImGuiBackendFlags_"][9]["value"] = "1 << 12"
 defs["enums"]["ImGuiButtonFlagsPrivate_"] = {}
 defs["enums"]["ImGuiButtonFlagsPrivate_"][1] = {}
 defs["enums"]["ImGuiButtonFlagsPrivate_"][1]["calc_value"] = 16
@@ -4519,6 +4527,9 @@ defs["structs"]["ImFont"][20] = {}
 defs["structs"]["ImFont"][20]["name"] = "Used4kPagesMap[(0xFFFF+1)/4096/8]"
 defs["structs"]["ImFont"][20]["size"] = 2
 defs["structs"]["ImFont"][20]["type"] = "ImU8"
+defs["structs"]["ImFont"][21] = {}
+defs["structs"]["ImFont"][21]["name"] = "TextSizeCache"
+defs["structs"]["ImFont"][21]["type"] = "ImFontTextSizeCache*"
 defs["structs"]["ImFontAtlas"] = {}
 defs["structs"]["ImFontAtlas"][1] = {}
 defs["structs"]["ImFontAtlas"][1]["name"] = "Flags"
@@ -4590,6 +4601,9 @@ defs["structs"]["ImFontAtlas"][21]["type"] = "int"
 defs["structs"]["ImFontAtlas"][22] = {}
 defs["structs"]["ImFontAtlas"][22]["name"] = "PackIdLines"
 defs["structs"]["ImFontAtlas"][22]["type"] = "int"
+defs["structs"]["ImFontAtlas"][23] = {}
+defs["structs"]["ImFontAtlas"][23]["name"] = "LazyGlyphs"
+defs["structs"]["ImFontAtlas"][23]["type"] = "ImFontAtlasLazyGlyphs*"
 defs["structs"]["ImFontAtlasCustomRect"] = {}
 defs["structs"]["ImFontAtlasCustomRect"][1] = {}
 defs["structs"]["ImFontAtlasCustomRect"][1]["name"] = "X"
@@ -21,10 +21,12 @@ defs["ImFont"] = "struct ImFont"
 defs["ImFontAtlas"] = "struct ImFontAtlas"
 defs["ImFontAtlasCustomRect"] = "struct ImFontAtlasCustomRect"
 defs["ImFontAtlasFlags"] = "int"
+defs["ImFontAtlasLazyGlyphs"] = "struct ImFontAtlasLazyGlyphs"
 defs["ImFontBuilderIO"] = "struct ImFontBuilderIO"
 defs["ImFontConfig"] = "struct ImFontConfig"
 defs["ImFontGlyph"] = "struct ImFontGlyph"
 defs["ImFontGlyphRangesBuilder"] = "struct ImFontGlyphRangesBuilder"
+defs["ImFontTextSizeCache"] = "struct ImFontTextSizeCache"
 defs["ImGuiActivateFlags"] = "int"
 defs["ImGuiBackendFlags"] = "int"
 defs["ImGuiBoxSelectState"] = "struct ImGuiBoxSelectState"
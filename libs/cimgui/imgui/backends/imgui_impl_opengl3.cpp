@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
+//  [X] Renderer: Font texture updates after the atlas is built (ImGuiBackendFlags_RendererHasTexUpdates), for 'io.Fonts->Flags |= ImFontAtlasFlags_LazyGlyphs'.
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +24,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: OpenGL: Added optional '#define IMGUI_IMPL_OPENGL_ALPHA8_FONT': single channel font texture (GL_R8 with swizzle) instead of RGBA32.
+//  2026-10-17: OpenGL: Added support for ImGuiBackendFlags_RendererHasTexUpdates: the font texture region changed by ImFontAtlasFlags_LazyGlyphs is uploaded again before rendering.
+//  2026-10-17: OpenGL: Added optional '#define IMGUI_IMPL_OPENGL_OWNS_STATE': no GL state backup/restore, only state changes are applied.
+//  2026-10-17: OpenGL: Added optional '#define IMGUI_IMPL_OPENGL_STREAMING': persistent VAO and a single ring-buffered upload of all draw lists per frame.
 //  2024-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2024-10-07: OpenGL: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-06-28: OpenGL: ImGui_ImplOpenGL3_NewFrame() recreates font texture if it has been destroyed by ImGui_ImplOpenGL3_DestroyFontsTexture(). (#7748)
@@ -211,6 +216,17 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// [Optional] Streaming uploads (see imgui_impl_opengl3.h) draw every list out of one shared buffer with glDrawElementsBaseVertex().
+// Contexts without it (GL ES, WebGL, Desktop GL < 3.2) keep uploading each draw list on its own.
+#if defined(IMGUI_IMPL_OPENGL_STREAMING) && defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET)
+#define IMGUI_IMPL_OPENGL_MAY_STREAM
+#endif
+
+// [Optional] Alpha8 font texture (see imgui_impl_opengl3.h) needs texture swizzle: Desktop GL 3.3+ or GL ES 3.0+, checked at runtime.
+#if defined(IMGUI_IMPL_OPENGL_ALPHA8_FONT) && !defined(IMGUI_IMPL_OPENGL_ES2) && defined(GL_TEXTURE_SWIZZLE_R)
+#define IMGUI_IMPL_OPENGL_MAY_ALPHA8_FONT
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -230,6 +246,11 @@ struct ImGui_ImplOpenGL3_Data
     bool            GlProfileIsCompat;
     GLint           GlProfileMask;
     GLuint          FontTexture;
+    int             FontTextureWidth;        // Size of FontTexture, which the atlas may grow with ImFontAtlasFlags_LazyGlyphs
+    int             FontTextureHeight;
+#ifdef IMGUI_IMPL_OPENGL_MAY_ALPHA8_FONT
+    bool            UseAlpha8Font;           // IMGUI_IMPL_OPENGL_ALPHA8_FONT on a context with texture swizzle: FontTexture is GL_R8
+#endif
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
@@ -242,6 +263,21 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    bool            UseStreaming;            // IMGUI_IMPL_OPENGL_STREAMING on a context with glDrawElementsBaseVertex()
+    bool            StreamVaoReady;          // Attributes of StreamVao point into VboHandle
+    GLuint          StreamVao;               // Persistent VAO of the main viewport
+    GLsizeiptr      StreamVtxOffset;         // Next free byte of the vertex/index buffer rings
+    GLsizeiptr      StreamIdxOffset;
+    ImVector<ImDrawVert> StreamVtxStaging;   // Every draw list of a frame, one after the other
+    ImVector<ImDrawIdx>  StreamIdxStaging;
+#endif
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    bool            StateValid;              // GL state is still the one this backend last set: fixed state, StateProjection, StateTexture
+    bool            StateClipOriginLowerLeft;
+    ImVec4          StateProjection;         // L, R, T, B of the projection matrix
+    GLuint          StateTexture;            // Bound to GL_TEXTURE0
+#endif
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -348,8 +384,15 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    bd->UseStreaming = (bd->GlVersion >= 320);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_ALPHA8_FONT
+    bd->UseAlpha8Font = bd->GlProfileIsES3 ? (bd->GlVersion >= 300) : (bd->GlVersion >= 330);
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;  // We can create multi-viewports on the Renderer side (optional)
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We can upload the font texture again when glyphs are added to it (optional)
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -405,7 +448,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasViewports);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasViewports | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -424,32 +467,53 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
+    // With IMGUI_IMPL_OPENGL_OWNS_STATE, nothing but this backend changes the GL state it sets, so once set it is kept
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    const bool setup_fixed_state = !bd->StateValid;
+#else
+    const bool setup_fixed_state = true;
+#endif
+
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
-    glEnable(GL_BLEND);
-    glBlendEquation(GL_FUNC_ADD);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_STENCIL_TEST);
-    glEnable(GL_SCISSOR_TEST);
+    if (setup_fixed_state)
+    {
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+        glActiveTexture(GL_TEXTURE0);
+#endif
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_CULL_FACE);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_STENCIL_TEST);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    if (bd->GlVersion >= 310)
-        glDisable(GL_PRIMITIVE_RESTART);
+        if (bd->GlVersion >= 310)
+            glDisable(GL_PRIMITIVE_RESTART);
 #endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
-    if (bd->HasPolygonMode)
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        if (bd->HasPolygonMode)
+            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 #endif
+    }
+    glEnable(GL_SCISSOR_TEST);
 
     // Support for GL 4.5 rarely used glClipControl(GL_UPPER_LEFT)
 #if defined(GL_CLIP_ORIGIN)
     bool clip_origin_lower_left = true;
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    if (!setup_fixed_state)
+        clip_origin_lower_left = bd->StateClipOriginLowerLeft;
+    else
+#endif
     if (bd->HasClipOrigin)
     {
         GLenum current_clip_origin = 0; glGetIntegerv(GL_CLIP_ORIGIN, (GLint*)&current_clip_origin);
         if (current_clip_origin == GL_UPPER_LEFT)
             clip_origin_lower_left = false;
     }
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    bd->StateClipOriginLowerLeft = clip_origin_lower_left;
+#endif
 #endif
 
     // Setup viewport, orthographic projection matrix
@@ -469,14 +533,32 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
-    glUseProgram(bd->ShaderHandle);
-    glUniform1i(bd->AttribLocationTex, 0);
-    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    bool setup_projection = setup_fixed_state;
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    setup_projection |= (bd->StateProjection.x != L || bd->StateProjection.y != R || bd->StateProjection.z != T || bd->StateProjection.w != B);
+    bd->StateProjection = ImVec4(L, R, T, B);
+#endif
+    if (setup_fixed_state)
+    {
+        glUseProgram(bd->ShaderHandle);
+        glUniform1i(bd->AttribLocationTex, 0);
+    }
+    if (setup_projection)
+        glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+    if (setup_fixed_state && (bd->GlVersion >= 330 || bd->GlProfileIsES3))
         glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
 #endif
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    if (setup_fixed_state)
+    {
+        // The texture binding is known from here on
+        glBindTexture(GL_TEXTURE_2D, 0);
+        bd->StateTexture = 0;
+        bd->StateValid = true;
+    }
+#endif
 
     (void)vertex_array_object;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -485,6 +567,15 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
     GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    // The persistent VAO keeps its element buffer and attributes from one frame to the next
+    if (vertex_array_object != 0 && vertex_array_object == bd->StreamVao)
+    {
+        if (bd->StreamVaoReady)
+            return;
+        bd->StreamVaoReady = true;
+    }
+#endif
     GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
@@ -494,6 +585,131 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+// Hands out the next 'size' bytes of a buffer used as a ring. When they don't fit, the buffer is orphaned: the driver
+// gives it fresh storage while the GPU may still read the old one, and the ring starts over. It is sized for three
+// frames of the largest upload seen, so this happens about every third frame rather than for every draw list.
+static GLintptr ImGui_ImplOpenGL3_StreamAlloc(GLenum target, GLsizeiptr* capacity, GLsizeiptr* offset, GLsizeiptr size)
+{
+    if (*offset + size > *capacity)
+    {
+        if (*capacity < size * 3)
+            *capacity = size * 3;
+        GL_CALL(glBufferData(target, *capacity, nullptr, GL_STREAM_DRAW));
+        *offset = 0;
+    }
+    GLintptr start = *offset;
+    *offset += size;
+    return start;
+}
+
+// Uploads the vertices and indices of every draw list with one glBufferSubData() per buffer.
+// Outputs where the first list starts in the buffers, in vertices and indices.
+static void ImGui_ImplOpenGL3_StreamUpload(ImDrawData* draw_data, int* vtx_start, int* idx_start)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    *vtx_start = *idx_start = 0;
+    if (draw_data->TotalVtxCount == 0)
+        return;
+    const ImDrawVert* vtx_data = nullptr;
+    const ImDrawIdx* idx_data = nullptr;
+    if (draw_data->CmdListsCount == 1)
+    {
+        vtx_data = draw_data->CmdLists[0]->VtxBuffer.Data;
+        idx_data = draw_data->CmdLists[0]->IdxBuffer.Data;
+    }
+    else
+    {
+        bd->StreamVtxStaging.resize(draw_data->TotalVtxCount);
+        bd->StreamIdxStaging.resize(draw_data->TotalIdxCount);
+        ImDrawVert* vtx_dst = bd->StreamVtxStaging.Data;
+        ImDrawIdx* idx_dst = bd->StreamIdxStaging.Data;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+            memcpy(idx_dst, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+            vtx_dst += draw_list->VtxBuffer.Size;
+            idx_dst += draw_list->IdxBuffer.Size;
+        }
+        vtx_data = bd->StreamVtxStaging.Data;
+        idx_data = bd->StreamIdxStaging.Data;
+    }
+
+    const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx);
+    const GLintptr vtx_offset = ImGui_ImplOpenGL3_StreamAlloc(GL_ARRAY_BUFFER, &bd->VertexBufferSize, &bd->StreamVtxOffset, vtx_buffer_size);
+    const GLintptr idx_offset = ImGui_ImplOpenGL3_StreamAlloc(GL_ELEMENT_ARRAY_BUFFER, &bd->IndexBufferSize, &bd->StreamIdxOffset, idx_buffer_size);
+    GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, vtx_offset, vtx_buffer_size, (const GLvoid*)vtx_data));
+    GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idx_offset, idx_buffer_size, (const GLvoid*)idx_data));
+    *vtx_start = (int)(vtx_offset / (GLintptr)sizeof(ImDrawVert));
+    *idx_start = (int)(idx_offset / (GLintptr)sizeof(ImDrawIdx));
+}
+#endif
+
+// Upload rows [y, y + h) of the font atlas into the bound FontTexture, or all of it into new storage when 'resize' is set.
+// With IMGUI_IMPL_OPENGL_ALPHA8_FONT the atlas is never expanded to RGBA32: GL_R8 holds coverage, swizzled to (1, 1, 1, R).
+static void ImGui_ImplOpenGL3_UploadFontsTexture(bool resize, int y, int h)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    GLint internal_format = GL_RGBA;
+    GLenum format = GL_RGBA;
+#ifdef IMGUI_IMPL_OPENGL_MAY_ALPHA8_FONT
+    if (bd->UseAlpha8Font)
+    {
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+        internal_format = GL_R8;
+        format = GL_RED;
+    }
+    else
+#endif
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+
+    // Also called from RenderDrawData() when glyphs were added: the pixel store state of the application is restored
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+#ifndef IMGUI_IMPL_OPENGL_OWNS_STATE
+    GLint last_unpack_row_length; GL_CALL(glGetIntegerv(GL_UNPACK_ROW_LENGTH, &last_unpack_row_length));
+#endif
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GLint last_unpack_alignment = 4;
+    if (bytes_per_pixel == 1)
+    {
+        GL_CALL(glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment));
+        GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    }
+    if (resize)
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels));
+    else
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, width, h, format, GL_UNSIGNED_BYTE, pixels + (size_t)y * width * bytes_per_pixel));
+    if (bytes_per_pixel == 1)
+        GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
+#if defined(GL_UNPACK_ROW_LENGTH) && !defined(IMGUI_IMPL_OPENGL_OWNS_STATE)
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, last_unpack_row_length));
+#endif
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+}
+
+// Upload the font texture region the atlas changed since the last frame (ImFontAtlasFlags_LazyGlyphs adds glyphs on first use).
+// Whole rows are uploaded, as GL_UNPACK_ROW_LENGTH isn't available on WebGL/ES 2.0.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    int x, y, w, h;
+    if (!bd->FontTexture || !io.Fonts->TakeTexDirtyRect(&x, &y, &w, &h))
+        return;
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+    ImGui_ImplOpenGL3_UploadFontsTexture(io.Fonts->TexWidth != bd->FontTextureWidth || io.Fonts->TexHeight != bd->FontTextureHeight, y, h);
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    bd->StateTexture = bd->FontTexture;
+#endif
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -507,6 +723,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
+    // Secondary viewports may share the GL context of the main one or have their own, so the state they leave is not tracked
+    const bool is_main_viewport = (draw_data->OwnerViewport == nullptr || draw_data->OwnerViewport == ImGui::GetMainViewport());
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    if (!is_main_viewport)
+        bd->StateValid = false;
+#else
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
     glActiveTexture(GL_TEXTURE0);
@@ -545,16 +767,36 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
+#endif // #ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
 
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
     GLuint vertex_array_object = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    // When streaming, the main viewport keeps its VAO. Secondary viewports may each have their own GL context, so they don't.
+    const bool use_stream_vao = bd->UseStreaming && is_main_viewport;
+    if (use_stream_vao && bd->StreamVao == 0)
+        GL_CALL(glGenVertexArrays(1, &bd->StreamVao));
+    if (use_stream_vao)
+        vertex_array_object = bd->StreamVao;
+    else
+#endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // Position of the current draw list in the buffers: always zero unless streaming, which uploads them all at once
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    if (bd->UseStreaming)
+        ImGui_ImplOpenGL3_StreamUpload(draw_data, &global_vtx_offset, &global_idx_offset);
+#endif
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
@@ -574,6 +816,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+        if (bd->UseStreaming)
+        {
+            // Already uploaded by ImGui_ImplOpenGL3_StreamUpload()
+        }
+        else
+#endif
         if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
@@ -602,6 +851,9 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+                bd->StateValid = false; // Callbacks may change any GL state
+#endif
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
                 else
@@ -619,22 +871,46 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                const GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+                if (!bd->StateValid || bd->StateTexture != texture)
+                    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+                bd->StateTexture = texture;
+#else
+                GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)), (GLint)(pcmd->VtxOffset + global_vtx_offset)));
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+        if (bd->UseStreaming)
+        {
+            global_vtx_offset += draw_list->VtxBuffer.Size;
+            global_idx_offset += draw_list->IdxBuffer.Size;
+        }
+#endif
     }
 
     // Destroy the temporary VAO
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    if (!use_stream_vao)
+#endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
 
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    // The only state given back: the application's glClear() must not be clipped to our last scissor rectangle
+    glDisable(GL_SCISSOR_TEST);
+    if (!is_main_viewport)
+        bd->StateValid = false;
+    (void)bd;
+#else
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
     if (last_program == 0 || glIsProgram(last_program)) glUseProgram(last_program);
@@ -673,6 +949,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
     glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
     (void)bd; // Not all compilation paths use this
+    (void)is_main_viewport;
+#endif // #ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
 }
 
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
@@ -680,12 +958,7 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     ImGuiIO& io = ImGui::GetIO();
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
-    // Build texture atlas
-    unsigned char* pixels;
-    int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
-
-    // Upload texture to graphics system
+    // Upload texture to graphics system (this builds the texture atlas)
     // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
     GLint last_texture;
     GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
@@ -695,10 +968,17 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
-    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#ifdef IMGUI_IMPL_OPENGL_MAY_ALPHA8_FONT
+    if (bd->UseAlpha8Font)
+    {
+        // Sampled as white with the coverage as alpha, like the RGBA32 texture: the shader and user textures are unchanged
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+    }
 #endif
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+    ImGui_ImplOpenGL3_UploadFontsTexture(true, 0, 0);
 
     // Store identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
@@ -719,6 +999,9 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    bd->StateValid = false; // The texture may have been bound
+#endif
 }
 
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
@@ -961,7 +1244,18 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+#ifdef IMGUI_IMPL_OPENGL_MAY_STREAM
+    if (bd->StreamVao)      { glDeleteVertexArrays(1, &bd->StreamVao); bd->StreamVao = 0; }
+    bd->StreamVaoReady = false;
+    bd->VertexBufferSize = bd->IndexBufferSize = 0;
+    bd->StreamVtxOffset = bd->StreamIdxOffset = 0;
+    bd->StreamVtxStaging.clear();
+    bd->StreamIdxStaging.clear();
+#endif
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+#ifdef IMGUI_IMPL_OPENGL_OWNS_STATE
+    bd->StateValid = false;
+#endif
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -45,6 +45,9 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
+//#define IMGUI_IMPL_OPENGL_STREAMING // Keep the VAO of the main viewport and upload all draw lists of a frame at once into ring-buffered VBO/IBO (Desktop GL 3.2+)
+//#define IMGUI_IMPL_OPENGL_OWNS_STATE // The application leaves the GL state to this backend: skip saving/restoring it and only apply what changed. Scissor test is left disabled.
+//#define IMGUI_IMPL_OPENGL_ALPHA8_FONT // Single channel font texture, swizzled to white + alpha, instead of the atlas expanded to RGBA32: 1/4 of the CPU and GPU memory (Desktop GL 3.3+, GL ES 3.0+)
 
 // You can explicitly select GLES2 or GLES3 API by using one of the '#define IMGUI_IMPL_OPENGL_LOADER_XXX' in imconfig.h or compiler command-line.
 #if !defined(IMGUI_IMPL_OPENGL_ES2) \
@@ -65,6 +65,27 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use a word-at-a-time hash (MurmurHash64A) instead of CRC32 for ImHashData()/ImHashStr(). Faster on long labels, '###' is still supported.
+// Changes every ID, so like the option above it invalidates docking/table data stored in existing .ini files.
+//#define IMGUI_USE_FAST_HASH
+
+//---- Use an open addressing hash table for ImGuiStorage lookups instead of a binary search over pairs sorted by key: O(1) inserts
+// and queries for windows with many stateful widgets. Adds fields to ImGuiStorage, so cimgui/binding struct definitions must be
+// generated with the same define.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Rasterize glyphs on several threads in ImFontAtlas::Build() (stb_truetype builder), with the same output as the serial build.
+// Uses std::thread: link with -pthread where needed. The allocator set with SetAllocatorFunctions() is called from the build threads
+// and needs to be thread-safe (the default malloc/free are). IMGUI_FONT_BUILD_THREADS sets the thread count, default is one per core.
+//#define IMGUI_USE_THREADED_FONT_BUILD
+//#define IMGUI_FONT_BUILD_THREADS      4
+
+//---- Cache the sizes of whole strings measured by ImFont::CalcTextSizeA() (CalcTextSize(), every label), per font, keyed by (text hash, size, wrap width)
+// and evicted least recently used first. Labels that don't change are then measured once rather than every frame. IMGUI_TEXT_SIZE_CACHE_ENTRIES
+// sets the number of strings remembered per font, default is 4096: keep it above the number of distinct labels drawn in a frame.
+//#define IMGUI_USE_TEXT_SIZE_CACHE
+//#define IMGUI_TEXT_SIZE_CACHE_ENTRIES 4096
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
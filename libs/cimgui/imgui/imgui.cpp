@@ -2212,7 +2212,7 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_USE_FAST_HASH)
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2258,6 +2258,57 @@ static const ImU32 GCrc32LookupTable[256] =
 };
 #endif
 
+#ifdef IMGUI_USE_FAST_HASH
+
+// Word-at-a-time hash (MurmurHash64A, folded to 32-bit): 8 bytes per step with two multiplies, no lookup table.
+// Loads go through memcpy() so unaligned data is fine. Results depend on the endianness of the host.
+static inline ImU64 ImHashLoad64(const unsigned char* data) { ImU64 v; memcpy(&v, data, sizeof(v)); return v; }
+
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    const ImU64 m = 0xC6A4A7935BD1E995ULL;
+    const int r = 47;
+    ImU64 h = (ImU64)seed ^ ((ImU64)data_size * m);
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = data + (data_size & ~(size_t)7);
+    for (; data != data_end; data += 8)
+    {
+        ImU64 k = ImHashLoad64(data);
+        k *= m; k ^= k >> r; k *= m;
+        h ^= k; h *= m;
+    }
+    if (const size_t rem = data_size & 7)
+    {
+        // the 1 to 7 trailing bytes, the first 4 in one load for the PushID(int) case
+        ImU64 k = 0;
+        size_t n = 0;
+        if (rem >= 4) { ImU32 lo; memcpy(&lo, data, sizeof(lo)); k = lo; n = 4; }
+        for (; n < rem; n++)
+            k |= (ImU64)data[n] << (n * 8);
+        h ^= k; h *= m;
+    }
+    h ^= h >> r; h *= m; h ^= h >> r;
+    return (ImGuiID)(h ^ (h >> 32));
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value.
+// The CRC32 version below resets at every ###, so only the bytes from the last ### on reach the hash:
+// find that suffix with memchr() and hash it in one go. Same rules as CRC32: a '#' starts a reset
+// when it is followed by two more '#'.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    const char* start = data_p;
+    for (const char* p = (const char*)memchr(data_p, '#', data_size); p != NULL; p = (const char*)memchr(p + 1, '#', (size_t)(data_end - p - 1)))
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            start = p;
+    return ImHashData(start, (size_t)(data_end - start), seed);
+}
+
+#else
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2327,6 +2378,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#endif // #ifdef IMGUI_USE_FAST_HASH
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2732,6 +2785,173 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+
+// Index slot of a key: keys are mostly hashes already, but PushID(int) and selection storage use small sequential integers.
+static inline int ImGuiStorageHomeSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key;
+    h ^= h >> 16; h *= 0x45D9F3B; h ^= h >> 16;
+    return (int)(h & (ImU32)mask);
+}
+
+// Rebuilds Index from Data, sized for Data.Size entries at most half full.
+static void ImGuiStorageBuildIndex(ImGuiStorage* storage)
+{
+    int capacity = 16;
+    while (capacity < storage->Data.Size * 2)
+        capacity <<= 1;
+    storage->Index.resize(capacity);
+    memset(storage->Index.Data, 0, (size_t)storage->Index.size_in_bytes());
+    const int mask = capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        const ImGuiID key = storage->Data.Data[n].key;
+        int slot = ImGuiStorageHomeSlot(key, mask);
+        while (storage->Index.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->Index.Data[slot] = ((ImU64)key << 32) | (ImU64)(n + 1);
+    }
+    storage->IndexedData = storage->Data.Data;
+    storage->IndexedSize = storage->Data.Size;
+}
+
+static ImGuiStoragePair* ImGuiStorageFind(ImGuiStorage* storage, ImGuiID key)
+{
+    // Data was resized, swapped or reserved directly (e.g. ImPool::Reserve(), ImGuiSelectionBasicStorage)
+    if (storage->IndexedData != storage->Data.Data || storage->IndexedSize != storage->Data.Size)
+        ImGuiStorageBuildIndex(storage);
+    if (storage->Data.Size == 0)
+        return NULL;
+    const int mask = storage->Index.Size - 1;
+    for (int slot = ImGuiStorageHomeSlot(key, mask); ; slot = (slot + 1) & mask)
+    {
+        const ImU64 entry = storage->Index.Data[slot];
+        if (entry == 0)
+            return NULL;
+        if ((ImGuiID)(entry >> 32) != key)
+            continue;
+        ImGuiStoragePair* it = &storage->Data.Data[(int)(entry & 0xFFFFFFFF) - 1];
+        if (it->key == key)
+            return it;
+        // Data was reordered in place (e.g. sorted by value): same keys, other positions
+        ImGuiStorageBuildIndex(storage);
+        return ImGuiStorageFind(storage, key);
+    }
+}
+
+// Appends a pair for a key ImGuiStorageFind() just failed to find, which left Index up to date.
+static ImGuiStoragePair* ImGuiStorageAdd(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->Index.Size)
+    {
+        ImGuiStorageBuildIndex(storage);
+    }
+    else
+    {
+        const int mask = storage->Index.Size - 1;
+        int slot = ImGuiStorageHomeSlot(pair.key, mask);
+        while (storage->Index.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->Index.Data[slot] = ((ImU64)pair.key << 32) | (ImU64)storage->Data.Size;
+        storage->IndexedData = storage->Data.Data;
+        storage->IndexedSize = storage->Data.Size;
+    }
+    return &storage->Data.back();
+}
+
+// Sorting is not needed for queries in this mode, but keeps iterating Data in key order for the code that relies on it.
+void ImGuiStorage::BuildSortByKey()
+{
+    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    ImGuiStorageBuildIndex(this);
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_i : default_val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    if (it == NULL)
+        it = ImGuiStorageAdd(this, ImGuiStoragePair(key, default_val));
+    return &it->val_i;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    if (it == NULL)
+        it = ImGuiStorageAdd(this, ImGuiStoragePair(key, default_val));
+    return &it->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    if (it == NULL)
+        it = ImGuiStorageAdd(this, ImGuiStoragePair(key, default_val));
+    return &it->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorageFind(this, key))
+        it->val_i = val;
+    else
+        ImGuiStorageAdd(this, ImGuiStoragePair(key, val));
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorageFind(this, key))
+        it->val_f = val;
+    else
+        ImGuiStorageAdd(this, ImGuiStoragePair(key, val));
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorageFind(this, key))
+        it->val_p = val;
+    else
+        ImGuiStorageAdd(this, ImGuiStoragePair(key, val));
+}
+
+#else
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2830,6 +3050,8 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
         it->val_p = val;
 }
 
+#endif // #ifdef IMGUI_USE_HASHED_STORAGE
+
 void ImGuiStorage::SetAllInt(int v)
 {
     for (int i = 0; i < Data.Size; i++)
@@ -5319,6 +5541,9 @@ void ImGui::NewFrame()
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
+    // Rasterize the glyphs of ImFontAtlasFlags_LazyGlyphs the last frame couldn't fit. May grow the texture: before anything is drawn.
+    ImFontAtlasBuildUpdateLazyGlyphs(g.IO.Fonts, (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates) != 0);
+
     // Setup current font and draw list shared data
     // FIXME-VIEWPORT: the concept of a single ClipRectFullscreen is not ideal!
     g.IO.Fonts->Locked = true;
@@ -20403,6 +20628,9 @@ static void ImGui::DockSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettings
     // (unlike our windows settings, because nodes are always built we can do a full rewrite of the SettingsNode buffer)
     dc->NodesSettings.resize(0);
     dc->NodesSettings.reserve(dc->Nodes.Data.Size);
+#ifdef IMGUI_USE_HASHED_STORAGE
+    dc->Nodes.BuildSortByKey(); // Write nodes in the same order as with the sorted storage
+#endif
     for (int n = 0; n < dc->Nodes.Data.Size; n++)
         if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
             if (node->IsRootNode())
@@ -21942,6 +22170,9 @@ void ImGui::DebugNodeFont(ImFont* font)
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+    if (const ImFontTextSizeCache* cache = font->TextSizeCache)
+        Text("Text size cache: %d strings, %" IM_PRIu64 " hits, %" IM_PRIu64 " misses (%.1f%% hits)", cache->Entries.Size, cache->Hits, cache->Misses,
+            cache->Hits + cache->Misses > 0 ? (double)cache->Hits * 100.0 / (double)(cache->Hits + cache->Misses) : 0.0);
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
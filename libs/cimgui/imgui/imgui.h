@@ -170,9 +170,11 @@ struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 byte
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
+struct ImFontAtlasLazyGlyphs;       // Opaque state of an atlas built with ImFontAtlasFlags_LazyGlyphs.
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontTextSizeCache;         // Sizes of the strings last measured with a font (IMGUI_USE_TEXT_SIZE_CACHE).
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui (also see: ImGuiPlatformIO)
@@ -1671,6 +1673,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,   // Backend Renderer uploads again the font texture region returned by ImFontAtlas::TakeTexDirtyRect() before rendering, and recreates the texture when its size changed. Required by ImFontAtlasFlags_LazyGlyphs.
 
     // [BETA] Viewports
     ImGuiBackendFlags_PlatformHasViewports  = 1 << 10,  // Backend Platform supports multiple viewports.
@@ -2713,11 +2716,24 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // With IMGUI_USE_HASHED_STORAGE, Data is in insertion order (until BuildSortByKey() is called) and Index is an open addressing
+    // table over it: one (key << 32 | (1 + index in Data)) per slot, 0 for empty slots. Queries and insertions are O(1).
+    // Index is rebuilt on the next query when Data was changed directly (resized, swapped, reordered).
+    ImVector<ImU64>                 Index;
+    ImGuiStoragePair*               IndexedData;
+    int                             IndexedSize;
+    ImGuiStorage()      { IndexedData = NULL; IndexedSize = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Index.clear(); IndexedData = NULL; IndexedSize = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -3334,6 +3350,7 @@ struct ImDrawData
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API int   MergeCmdLists(ImDrawList* merged_list); // Helper to copy all lists into 'merged_list', which then replaces them, merging adjacent draw commands where it doesn't change the output. Returns the number of draw commands before, merged_list->CmdBuffer.Size is the number after.
 };
 
 //-----------------------------------------------------------------------------
@@ -3419,6 +3436,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_LazyGlyphs         = 1 << 3,   // Build() only rasterizes U+0000..U+00FF and the fallback/ellipsis characters, other glyphs of the ranges are rasterized into free texture space on first use (e.g. large CJK ranges). Needs the stb_truetype builder and a backend with ImGuiBackendFlags_RendererHasTexUpdates.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3464,6 +3482,19 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Build cache: save the output of Build() to a file, and load it back on later runs instead of rasterizing glyphs again.
+    // - After adding fonts, call LoadCacheFromDisk(): it returns true and the atlas is built when the file was saved from the same font data, sizes, ranges and options.
+    // - Otherwise call Build() then SaveCacheToDisk(). Custom rectangles get their positions back, render your pixels into them after either.
+    // - Only the default font builder is supported (FontBuilderIO == NULL).
+    IMGUI_API bool              LoadCacheFromDisk(const char* filename);
+    IMGUI_API bool              SaveCacheToDisk(const char* filename);
+
+    // Lazy glyphs: with ImFontAtlasFlags_LazyGlyphs, texture pixels change after Build() when a glyph is first used.
+    // - The renderer backend calls TakeTexDirtyRect() before rendering and uploads that region again (the whole texture if TexWidth/TexHeight changed).
+    // - The CPU-side pixels and font data are needed to rasterize glyphs: ClearTexData() and ClearInputData() stop adding glyphs.
+    // - Atlases built this way aren't saved by SaveCacheToDisk(): there is little to rasterize at startup.
+    IMGUI_API bool              TakeTexDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h); // Returns false when no pixel changed since the last call.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -3534,6 +3565,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    ImFontAtlasLazyGlyphs*      LazyGlyphs;         // Glyphs left to rasterize on first use, packer and dirty region (ImFontAtlasFlags_LazyGlyphs)
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -3569,6 +3601,7 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImFontTextSizeCache*        TextSizeCache;      // 4-8   // out //            // With IMGUI_USE_TEXT_SIZE_CACHE: sizes returned by CalcTextSizeA() for recently measured strings, created on first use.
 
     // Methods
     IMGUI_API ImFont();
@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
+// [SECTION] ImFontAtlas: build cache
 // [SECTION] ImFontAtlas: glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
@@ -39,6 +40,10 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#ifdef IMGUI_USE_THREADED_FONT_BUILD
+#include <atomic>       // std::atomic
+#include <thread>       // std::thread
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -131,8 +136,18 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
+#ifdef IMGUI_USE_THREADED_FONT_BUILD
+// The build threads pass an ImFontBuildThreadAllocator as stb_truetype's allocator context and allocate through the allocator
+// functions directly: IM_ALLOC() also updates the debug counters of the current ImGuiContext, which isn't thread-safe.
+struct ImFontBuildThreadAllocator { ImGuiMemAllocFunc AllocFunc; ImGuiMemFreeFunc FreeFunc; void* UserData; };
+static inline void* ImFontBuildThreadAlloc(size_t size, void* allocator) { ImFontBuildThreadAllocator* a = (ImFontBuildThreadAllocator*)allocator; return a->AllocFunc(size, a->UserData); }
+static inline void  ImFontBuildThreadFree(void* ptr, void* allocator)    { ImFontBuildThreadAllocator* a = (ImFontBuildThreadAllocator*)allocator; a->FreeFunc(ptr, a->UserData); }
+#define STBTT_malloc(x,u)   ((u) ? ImFontBuildThreadAlloc(x,u) : IM_ALLOC(x))
+#define STBTT_free(x,u)     ((u) ? ImFontBuildThreadFree(x,u) : IM_FREE(x))
+#else
 #define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
 #define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#endif
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -2309,6 +2324,128 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+// Post-process for renderers where draw calls are expensive, to call after Render(): copies the vertices and indices of
+// every draw list into 'merged_list', which then replaces them in CmdLists, and merges adjacent draw commands using the
+// same texture. Draw lists and channel merges often leave such commands next to each other with different clip
+// rectangles: those are merged only when none of their vertices is clipped, with a margin of a few framebuffer pixels
+// for the rounding of scissor rectangles, and the merged command uses the union of the clip rectangles.
+// Callbacks stay in place, stop merging, and are called with 'merged_list' as their parent list.
+int ImDrawData::MergeCmdLists(ImDrawList* merged_list)
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    int cmd_count = 0;
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        IM_ASSERT(draw_list != merged_list);
+        cmd_count += draw_list->CmdBuffer.Size;
+    }
+
+    // Without ImGuiBackendFlags_RendererHasVtxOffset, 16-bit indices can only reach the first 64K vertices of the merged list
+    const bool has_vtx_offset = (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) != 0;
+    if (CmdListsCount == 0 || (sizeof(ImDrawIdx) == 2 && !has_vtx_offset && TotalVtxCount > 0xFFFF))
+        return cmd_count;
+
+    merged_list->CmdBuffer.resize(0);
+    merged_list->IdxBuffer.resize(0);
+    merged_list->VtxBuffer.resize(0);
+    merged_list->_CallbacksDataBuf.resize(0);
+    merged_list->VtxBuffer.reserve(TotalVtxCount);
+    merged_list->IdxBuffer.reserve(TotalIdxCount);
+    const float clip_margin = 3.0f;
+    const ImVec2 margin(FramebufferScale.x > 0.0f ? clip_margin / FramebufferScale.x : clip_margin, FramebufferScale.y > 0.0f ? clip_margin / FramebufferScale.y : clip_margin);
+
+    bool merge_open = false;    // Last command of merged_list may receive more indices
+    bool merge_unclipped = false; // None of its vertices is clipped, so its clip rectangle may grow
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        const unsigned int vtx_start = (unsigned int)merged_list->VtxBuffer.Size;
+        merged_list->VtxBuffer.resize(merged_list->VtxBuffer.Size + draw_list->VtxBuffer.Size);
+        memcpy(merged_list->VtxBuffer.Data + vtx_start, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+            {
+                ImDrawCmd callback_cmd = cmd;
+                if (cmd.UserCallbackDataOffset != -1 && cmd.UserCallbackDataSize > 0)
+                {
+                    callback_cmd.UserCallbackDataOffset = merged_list->_CallbacksDataBuf.Size;
+                    merged_list->_CallbacksDataBuf.resize(merged_list->_CallbacksDataBuf.Size + cmd.UserCallbackDataSize);
+                    memcpy(merged_list->_CallbacksDataBuf.Data + callback_cmd.UserCallbackDataOffset, draw_list->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset, (size_t)cmd.UserCallbackDataSize);
+                }
+                callback_cmd.VtxOffset = has_vtx_offset ? vtx_start + cmd.VtxOffset : 0;
+                callback_cmd.IdxOffset = (unsigned int)merged_list->IdxBuffer.Size;
+                callback_cmd.ElemCount = 0;
+                merged_list->CmdBuffer.push_back(callback_cmd);
+                merge_open = false;
+                continue;
+            }
+            if (cmd.ElemCount == 0)
+                continue;
+
+            // Bounds of the vertices, and the highest index for the 16-bit limit
+            const ImDrawIdx* src_idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            const ImDrawVert* src_vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+            ImVec2 bb_min(FLT_MAX, FLT_MAX), bb_max(-FLT_MAX, -FLT_MAX);
+            unsigned int max_idx = 0;
+            for (unsigned int i = 0; i < cmd.ElemCount; i++)
+            {
+                const ImVec2 pos = src_vtx[src_idx[i]].pos;
+                bb_min = ImMin(bb_min, pos);
+                bb_max = ImMax(bb_max, pos);
+                max_idx = ImMax(max_idx, (unsigned int)src_idx[i]);
+            }
+            const bool unclipped = bb_min.x >= cmd.ClipRect.x + margin.x && bb_min.y >= cmd.ClipRect.y + margin.y && bb_max.x <= cmd.ClipRect.z - margin.x && bb_max.y <= cmd.ClipRect.w - margin.y;
+            const unsigned int cmd_vtx_offset = has_vtx_offset ? vtx_start + cmd.VtxOffset : 0;
+
+            ImDrawCmd* merge_cmd = merge_open ? &merged_list->CmdBuffer.back() : NULL;
+            bool merge = merge_cmd != NULL && merge_cmd->TextureId == cmd.TextureId;
+            const bool same_clip = merge && memcmp(&merge_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) == 0;
+            merge = merge && (same_clip || (merge_unclipped && unclipped));
+            if (merge && sizeof(ImDrawIdx) == 2 && has_vtx_offset && cmd_vtx_offset - merge_cmd->VtxOffset + max_idx > 0xFFFF)
+                merge = false;
+            if (merge)
+            {
+                if (!same_clip)
+                    merge_cmd->ClipRect = ImVec4(ImMin(merge_cmd->ClipRect.x, cmd.ClipRect.x), ImMin(merge_cmd->ClipRect.y, cmd.ClipRect.y), ImMax(merge_cmd->ClipRect.z, cmd.ClipRect.z), ImMax(merge_cmd->ClipRect.w, cmd.ClipRect.w));
+                merge_unclipped &= unclipped;
+            }
+            else
+            {
+                ImDrawCmd new_cmd = cmd;
+                new_cmd.VtxOffset = cmd_vtx_offset;
+                new_cmd.IdxOffset = (unsigned int)merged_list->IdxBuffer.Size;
+                new_cmd.ElemCount = 0;
+                merged_list->CmdBuffer.push_back(new_cmd);
+                merge_cmd = &merged_list->CmdBuffer.back();
+                merge_open = true;
+                merge_unclipped = unclipped;
+            }
+
+            // Indices are relative to the VtxOffset of the command they end up in
+            const unsigned int idx_delta = has_vtx_offset ? cmd_vtx_offset - merge_cmd->VtxOffset : vtx_start;
+            const int idx_start = merged_list->IdxBuffer.Size;
+            merged_list->IdxBuffer.resize(idx_start + (int)cmd.ElemCount);
+            ImDrawIdx* dst_idx = merged_list->IdxBuffer.Data + idx_start;
+            if (idx_delta == 0)
+                memcpy(dst_idx, src_idx, (size_t)cmd.ElemCount * sizeof(ImDrawIdx));
+            else
+                for (unsigned int i = 0; i < cmd.ElemCount; i++)
+                    dst_idx[i] = (ImDrawIdx)(src_idx[i] + idx_delta);
+            merge_cmd->ElemCount += cmd.ElemCount;
+        }
+    }
+
+    // Callback data moved along with the commands
+    for (ImDrawCmd& cmd : merged_list->CmdBuffer)
+        if (cmd.UserCallback != NULL && cmd.UserCallbackDataOffset != -1 && cmd.UserCallbackDataSize > 0)
+            cmd.UserCallbackData = merged_list->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset;
+
+    CmdLists.resize(0);
+    CmdLists.push_back(merged_list);
+    CmdListsCount = 1;
+    return cmd_count;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -2473,6 +2610,7 @@ void    ImFontAtlas::ClearInputData()
     ConfigData.clear();
     CustomRects.clear();
     PackIdMouseCursors = PackIdLines = -1;
+    ImFontAtlasBuildClearLazyGlyphs(this);
     // Important: we leave TexReady untouched
 }
 
@@ -2486,6 +2624,7 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    ImFontAtlasBuildClearLazyGlyphs(this);
     // Important: we leave TexReady untouched
 }
 
@@ -2494,6 +2633,7 @@ void    ImFontAtlas::ClearFonts()
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     Fonts.clear_delete();
     TexReady = false;
+    ImFontAtlasBuildClearLazyGlyphs(this);
 }
 
 void    ImFontAtlas::Clear()
@@ -2526,10 +2666,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
         if (pixels)
         {
             TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
-            const unsigned char* src = pixels;
-            unsigned int* dst = TexPixelsRGBA32;
-            for (int n = TexWidth * TexHeight; n > 0; n--)
-                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+            ImFontAtlasBuildExpandAlpha8ToRGBA32(pixels, TexPixelsRGBA32, (size_t)TexWidth * (size_t)TexHeight);
         }
     }
 
@@ -2794,6 +2931,26 @@ void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsig
             *data = table[*data];
 }
 
+// White RGBA32 pixels with the alpha of 'src', as GetTexDataAsRGBA32() returns them (alpha is the high byte with either packing order)
+void    ImFontAtlasBuildExpandAlpha8ToRGBA32(const unsigned char* src, unsigned int* dst, size_t count)
+{
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    const __m128i white = _mm_set1_epi8((char)0xFF);
+    for (; count >= 16; count -= 16, src += 16, dst += 16)
+    {
+        const __m128i alpha = _mm_loadu_si128((const __m128i*)(const void*)src);
+        const __m128i white_alpha_lo = _mm_unpacklo_epi8(white, alpha); // FF,a0,FF,a1,...
+        const __m128i white_alpha_hi = _mm_unpackhi_epi8(white, alpha);
+        _mm_storeu_si128((__m128i*)(void*)(dst + 0), _mm_unpacklo_epi16(white, white_alpha_lo)); // FF,FF,FF,a0,...
+        _mm_storeu_si128((__m128i*)(void*)(dst + 4), _mm_unpackhi_epi16(white, white_alpha_lo));
+        _mm_storeu_si128((__m128i*)(void*)(dst + 8), _mm_unpacklo_epi16(white, white_alpha_hi));
+        _mm_storeu_si128((__m128i*)(void*)(dst + 12), _mm_unpackhi_epi16(white, white_alpha_hi));
+    }
+#endif
+    for (; count > 0; count--)
+        *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+}
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
@@ -2820,6 +2977,26 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// A run of glyphs of one source font: the unit of work of the gather and render steps, so that with IMGUI_USE_THREADED_FONT_BUILD
+// a single large font (e.g. CJK ranges) is spread over all threads. Each glyph has its own rectangle, so the output doesn't depend
+// on the order chunks are processed in.
+struct ImFontBuildChunk
+{
+    int                 SrcIndex;
+    int                 GlyphsBegin;
+    int                 GlyphsCount;
+    int                 Surface;            // Output of the gather step
+};
+
+struct ImFontBuildJobs
+{
+    ImFontAtlas*                atlas;
+    ImFontBuildSrcData*         SrcTmp;
+    ImVector<ImFontBuildChunk>  Chunks;
+    stbtt_pack_context          PackContext;    // Template for the render step, copied per chunk as rendering writes to it
+    void*                       AllocContext;   // stb_truetype allocator context: NULL, or an ImFontBuildThreadAllocator
+};
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2832,6 +3009,402 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+static float ImFontAtlasBuildCalcFontScale(const stbtt_fontinfo* font_info, const ImFontConfig& cfg)
+{
+    return (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels * cfg.RasterizerDensity);
+}
+
+// Size of the rectangle to pack for a glyph (this is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildCalcGlyphRectSize(const stbtt_fontinfo* font_info, const ImFontConfig& cfg, float scale, int pack_padding, int codepoint, stbrp_rect* rect)
+{
+    int x0, y0, x1, y1;
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoint);
+    IM_ASSERT(glyph_index_in_font != 0);
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    rect->w = (stbrp_coord)(x1 - x0 + pack_padding + cfg.OversampleH - 1);
+    rect->h = (stbrp_coord)(y1 - y0 + pack_padding + cfg.OversampleV - 1);
+}
+
+// Gather the sizes of the rectangles of a chunk
+static void ImFontAtlasBuildGatherChunk(ImFontBuildJobs* jobs, int chunk_n)
+{
+    ImFontBuildChunk& chunk = jobs->Chunks[chunk_n];
+    ImFontBuildSrcData& src_tmp = jobs->SrcTmp[chunk.SrcIndex];
+    const ImFontConfig& cfg = jobs->atlas->ConfigData[chunk.SrcIndex];
+    const int pack_padding = jobs->atlas->TexGlyphPadding;
+    const float scale = ImFontAtlasBuildCalcFontScale(&src_tmp.FontInfo, cfg);
+    chunk.Surface = 0;
+    for (int glyph_i = chunk.GlyphsBegin; glyph_i < chunk.GlyphsBegin + chunk.GlyphsCount; glyph_i++)
+    {
+        ImFontAtlasBuildCalcGlyphRectSize(&src_tmp.FontInfo, cfg, scale, pack_padding, src_tmp.GlyphsList[glyph_i], &src_tmp.Rects[glyph_i]);
+        chunk.Surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+    }
+}
+
+// Render the glyphs of a chunk into their packed rectangles, then apply the multiply operator
+static void ImFontAtlasBuildRenderChunk(ImFontBuildJobs* jobs, int chunk_n)
+{
+    const ImFontBuildChunk& chunk = jobs->Chunks[chunk_n];
+    const ImFontBuildSrcData& src_tmp = jobs->SrcTmp[chunk.SrcIndex];
+    const ImFontConfig& cfg = jobs->atlas->ConfigData[chunk.SrcIndex];
+
+    // stbtt_PackFontRangesRenderIntoRects() writes oversampling to the pack context and the allocator context to the font info
+    stbtt_pack_context spc = jobs->PackContext;
+    spc.user_allocator_context = jobs->AllocContext;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints = src_tmp.GlyphsList.Data + chunk.GlyphsBegin;
+    pack_range.num_chars = chunk.GlyphsCount;
+    pack_range.chardata_for_range = src_tmp.PackedChars + chunk.GlyphsBegin;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, src_tmp.Rects + chunk.GlyphsBegin);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        const stbrp_rect* r = &src_tmp.Rects[chunk.GlyphsBegin];
+        for (int glyph_i = 0; glyph_i < chunk.GlyphsCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, jobs->atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, jobs->atlas->TexWidth * 1);
+    }
+}
+
+#ifdef IMGUI_USE_THREADED_FONT_BUILD
+struct ImFontBuildThreadJobs
+{
+    ImFontBuildJobs*    Jobs;
+    void                (*JobFunc)(ImFontBuildJobs* jobs, int chunk_n);
+    std::atomic<int>    NextChunk;
+};
+
+static void ImFontAtlasBuildThreadMain(ImFontBuildThreadJobs* thread_jobs)
+{
+    for (int chunk_n = thread_jobs->NextChunk++; chunk_n < thread_jobs->Jobs->Chunks.Size; chunk_n = thread_jobs->NextChunk++)
+        thread_jobs->JobFunc(thread_jobs->Jobs, chunk_n);
+}
+#endif
+
+// Run 'job_func' on every chunk, on IMGUI_FONT_BUILD_THREADS threads (default: one per core) with IMGUI_USE_THREADED_FONT_BUILD
+static void ImFontAtlasBuildRunJobs(ImFontBuildJobs* jobs, void (*job_func)(ImFontBuildJobs* jobs, int chunk_n))
+{
+#ifdef IMGUI_USE_THREADED_FONT_BUILD
+#ifdef IMGUI_FONT_BUILD_THREADS
+    int threads_count = IMGUI_FONT_BUILD_THREADS;
+#else
+    int threads_count = (int)std::thread::hardware_concurrency();
+#endif
+    const int THREADS_MAX = 64;
+    threads_count = ImClamp(threads_count, 1, ImMin(jobs->Chunks.Size, THREADS_MAX));
+    ImFontBuildThreadJobs thread_jobs;
+    thread_jobs.Jobs = jobs;
+    thread_jobs.JobFunc = job_func;
+    thread_jobs.NextChunk = 0;
+    std::thread threads[THREADS_MAX];
+    for (int thread_n = 1; thread_n < threads_count; thread_n++)
+        threads[thread_n] = std::thread(ImFontAtlasBuildThreadMain, &thread_jobs);
+    ImFontAtlasBuildThreadMain(&thread_jobs); // The calling thread is the first worker
+    for (int thread_n = 1; thread_n < threads_count; thread_n++)
+        threads[thread_n].join();
+#else
+    for (int chunk_n = 0; chunk_n < jobs->Chunks.Size; chunk_n++)
+        job_func(jobs, chunk_n);
+#endif
+}
+
+// Register a rasterized glyph with its destination font (position and advance in pixels, UV from the packed rectangle)
+static void ImFontAtlasBuildAddPackedGlyph(ImFontAtlas* atlas, ImFontConfig& cfg, const stbtt_packedchar* packed_chars, int char_index, int codepoint)
+{
+    ImFont* dst_font = cfg.DstFont;
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
+    const float inv_rasterization_scale = 1.0f / cfg.RasterizerDensity;
+
+    const stbtt_packedchar& pc = packed_chars[char_index];
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(packed_chars, atlas->TexWidth, atlas->TexHeight, char_index, &unused_x, &unused_y, &q, 0);
+    float x0 = q.x0 * inv_rasterization_scale + font_off_x;
+    float y0 = q.y0 * inv_rasterization_scale + font_off_y;
+    float x1 = q.x1 * inv_rasterization_scale + font_off_x;
+    float y1 = q.y1 * inv_rasterization_scale + font_off_y;
+    dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
+}
+
+//-----------------------------------------------------------------------------
+// ImFontAtlasFlags_LazyGlyphs
+//-----------------------------------------------------------------------------
+// Build() rasterizes the first 256 codepoints and leaves the rest of the ranges for later: their advance is known (text layout
+// doesn't change), and the first ImFont::FindGlyph() miss rasterizes them into free space of the texture, with the packer kept
+// from Build(). A glyph packed below the bottom of the texture waits for the next ImGui::NewFrame(), which grows the texture
+// (rescaling V of everything already in it, which is why it can't happen while a frame is being drawn) and rasterizes it.
+//-----------------------------------------------------------------------------
+
+static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas);
+static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas);
+
+struct ImFontAtlasLazySrc
+{
+    stbtt_fontinfo      FontInfo;
+    ImBitVector         GlyphsSet;          // Requested, present in the font data and not rasterized yet
+};
+
+struct ImFontAtlasLazyPendingGlyph
+{
+    int                 SrcIndex;
+    int                 Codepoint;
+    stbrp_rect          Rect;               // Packed at least partly below TexHeight
+};
+
+struct ImFontAtlasLazyGlyphs
+{
+    ImVector<ImFontAtlasLazySrc>            Srcs;           // Parallel to atlas->ConfigData[]
+    stbtt_pack_context                      PackContext;    // Packer of Build(), spanning its whole virtual height
+    ImVector<ImFontAtlasLazyPendingGlyph>   Pending;        // Rasterized after the texture grows
+    bool                                    Enabled;        // io.BackendFlags has ImGuiBackendFlags_RendererHasTexUpdates
+    int                                     DirtyX0, DirtyY0, DirtyX1, DirtyY1; // Texture region changed since TakeTexDirtyRect() (empty when X0 >= X1)
+
+    ImFontAtlasLazyGlyphs() { memset(&PackContext, 0, sizeof(PackContext)); Enabled = false; DirtyX0 = DirtyY0 = DirtyX1 = DirtyY1 = 0; }
+};
+
+// Build() rasterizes the characters ImFont::BuildLookupTable() looks for as fallback and ellipsis, so it picks the same ones as without the flag
+static bool ImFontAtlasBuildIsGlyphLazy(const ImFontConfig& cfg, unsigned int codepoint)
+{
+    const ImFont* font = cfg.DstFont;
+    if (codepoint < 0x100 || codepoint == IM_UNICODE_CODEPOINT_INVALID || codepoint == 0x2026 || codepoint == 0xFF0E)
+        return false;
+    return codepoint != (unsigned int)font->FallbackChar && codepoint != (unsigned int)font->EllipsisChar;
+}
+
+static void ImFontAtlasBuildLazyAddDirtyRect(ImFontAtlasLazyGlyphs* lazy, int x0, int y0, int x1, int y1)
+{
+    if (lazy->DirtyX0 < lazy->DirtyX1)
+    {
+        x0 = ImMin(x0, lazy->DirtyX0);
+        y0 = ImMin(y0, lazy->DirtyY0);
+        x1 = ImMax(x1, lazy->DirtyX1);
+        y1 = ImMax(y1, lazy->DirtyY1);
+    }
+    lazy->DirtyX0 = x0;
+    lazy->DirtyY0 = y0;
+    lazy->DirtyX1 = x1;
+    lazy->DirtyY1 = y1;
+}
+
+// The advance the glyph will have once rasterized: stbtt_PackFontRangesRenderIntoRects(), then ImFont::AddGlyph()
+static float ImFontAtlasBuildLazyCalcAdvanceX(const stbtt_fontinfo* font_info, const ImFontConfig& cfg, int codepoint)
+{
+    int advance, lsb;
+    stbtt_GetCodepointHMetrics(font_info, codepoint, &advance, &lsb);
+    const float xadvance = ImFontAtlasBuildCalcFontScale(font_info, cfg) * advance;
+    float advance_x = ImClamp(xadvance * (1.0f / cfg.RasterizerDensity), cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    if (cfg.PixelSnapH)
+        advance_x = IM_ROUND(advance_x);
+    return advance_x + cfg.GlyphExtraSpacing.x;
+}
+
+// Called at the end of Build(): the lookup tables of the fonts cover the glyphs left for later
+static void ImFontAtlasBuildInitLazyGlyphs(ImFontAtlas* atlas, ImFontAtlasLazyGlyphs* lazy)
+{
+    atlas->LazyGlyphs = lazy;
+
+    // ImFont::Glyphs never grows past this, so glyph pointers stay valid while glyphs are added during a frame.
+    // Merged sources (MergeMode) share their font: reserve once for the lazy glyphs of all of them.
+    ImVector<int> codepoints;
+    for (ImFont* font : atlas->Fonts)
+    {
+        int lazy_count = 0;
+        for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+            if (atlas->ConfigData[src_i].DstFont == font)
+            {
+                codepoints.resize(0);
+                UnpackBitVectorToFlatIndexList(&lazy->Srcs[src_i].GlyphsSet, &codepoints);
+                lazy_count += codepoints.Size;
+            }
+        if (lazy_count == 0)
+            continue;
+        const int fallback_glyph_index = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        font->Glyphs.reserve(font->Glyphs.Size + lazy_count);
+        if (fallback_glyph_index >= 0)
+            font->FallbackGlyph = &font->Glyphs[fallback_glyph_index];
+    }
+
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        ImFontAtlasLazySrc& src = lazy->Srcs[src_i];
+        ImFont* font = cfg.DstFont;
+        codepoints.resize(0);
+        UnpackBitVectorToFlatIndexList(&src.GlyphsSet, &codepoints);
+        if (codepoints.Size == 0)
+            continue;
+        font->GrowIndex(codepoints.back() + 1);
+        for (int codepoint : codepoints)
+        {
+            font->IndexAdvanceX[codepoint] = ImFontAtlasBuildLazyCalcAdvanceX(&src.FontInfo, cfg, codepoint);
+            const int page_n = codepoint / 4096;
+            font->Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+        }
+    }
+    for (ImFont* font : atlas->Fonts)
+        for (float& advance_x : font->IndexAdvanceX)
+            if (advance_x < 0.0f)
+                advance_x = font->FallbackAdvanceX;
+}
+
+// Rasterize a glyph into its packed rectangle (within the texture) and register it
+static const ImFontGlyph* ImFontAtlasBuildLazyRenderGlyph(ImFontAtlas* atlas, int src_i, int codepoint, stbrp_rect* rect)
+{
+    ImFontAtlasLazyGlyphs* lazy = atlas->LazyGlyphs;
+    ImFontConfig& cfg = atlas->ConfigData[src_i];
+    IM_ASSERT(rect->was_packed && rect->y + rect->h <= atlas->TexHeight);
+
+    stbtt_packedchar packed_char = {};
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels * cfg.RasterizerDensity;
+    pack_range.array_of_unicode_codepoints = &codepoint;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &packed_char;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_PackFontRangesRenderIntoRects(&lazy->PackContext, &lazy->Srcs[src_i].FontInfo, &pack_range, 1, rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect->x, rect->y, rect->w, rect->h, atlas->TexWidth * 1);
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int y = rect->y; y < rect->y + rect->h; y++)
+            ImFontAtlasBuildExpandAlpha8ToRGBA32(atlas->TexPixelsAlpha8 + rect->x + (size_t)y * atlas->TexWidth, atlas->TexPixelsRGBA32 + rect->x + (size_t)y * atlas->TexWidth, (size_t)rect->w);
+    ImFontAtlasBuildLazyAddDirtyRect(lazy, rect->x, rect->y, rect->x + rect->w, rect->y + rect->h);
+
+    // Same as ImFont::BuildLookupTable() for one glyph (ImFont::Glyphs was reserved, see ImFontAtlasBuildInitLazyGlyphs())
+    ImFont* font = cfg.DstFont;
+    IM_ASSERT(font->Glyphs.Size < font->Glyphs.Capacity);
+    ImFontAtlasBuildAddPackedGlyph(atlas, cfg, &packed_char, 0, codepoint);
+    font->IndexLookup[codepoint] = (ImWchar)(font->Glyphs.Size - 1);
+    font->IndexAdvanceX[codepoint] = font->Glyphs.back().AdvanceX;
+    font->DirtyLookupTables = false;
+    return &font->Glyphs.back();
+}
+
+// Called by ImFont::FindGlyph() on a miss. Returns NULL when 'c' isn't left to rasterize for this font, or can't be this frame.
+const ImFontGlyph* ImFontAtlasBuildLazyGlyph(ImFontAtlas* atlas, ImFont* font, ImWchar c)
+{
+    ImFontAtlasLazyGlyphs* lazy = atlas->LazyGlyphs;
+    if (lazy == NULL || !lazy->Enabled)
+        return NULL;
+
+    // Sources merged into a font are searched in order, as in Build()
+    int src_i = 0;
+    for (; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImBitVector& glyphs_set = lazy->Srcs[src_i].GlyphsSet;
+        if (atlas->ConfigData[src_i].DstFont == font && (int)c < (glyphs_set.Storage.Size << 5) && glyphs_set.TestBit(c))
+            break;
+    }
+    if (src_i == atlas->ConfigData.Size)
+        return NULL;
+    ImFontAtlasLazySrc& src = lazy->Srcs[src_i];
+    const ImFontConfig& cfg = atlas->ConfigData[src_i];
+    src.GlyphsSet.ClearBit(c);
+
+    stbrp_rect rect = {};
+    ImFontAtlasBuildCalcGlyphRectSize(&src.FontInfo, cfg, ImFontAtlasBuildCalcFontScale(&src.FontInfo, cfg), atlas->TexGlyphPadding, c, &rect);
+    stbrp_pack_rects((stbrp_context*)lazy->PackContext.pack_info, &rect, 1);
+    if (!rect.was_packed)
+        return NULL; // Out of packer space: the glyph stays missing
+    if (rect.y + rect.h > atlas->TexHeight)
+    {
+        ImFontAtlasLazyPendingGlyph pending = { src_i, (int)c, rect };
+        lazy->Pending.push_back(pending);
+        return NULL;
+    }
+    return ImFontAtlasBuildLazyRenderGlyph(atlas, src_i, c, &rect);
+}
+
+static void ImFontAtlasBuildLazyGrowTexture(ImFontAtlas* atlas, int new_height)
+{
+    ImFontAtlasLazyGlyphs* lazy = atlas->LazyGlyphs;
+    const int old_height = atlas->TexHeight;
+    const size_t old_size = (size_t)atlas->TexWidth * (size_t)old_height;
+    const size_t new_size = (size_t)atlas->TexWidth * (size_t)new_height;
+    unsigned char* pixels_alpha8 = (unsigned char*)IM_ALLOC(new_size);
+    memcpy(pixels_alpha8, atlas->TexPixelsAlpha8, old_size);
+    memset(pixels_alpha8 + old_size, 0, new_size - old_size);
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = pixels_alpha8;
+    if (atlas->TexPixelsRGBA32 != NULL)
+    {
+        unsigned int* pixels_rgba32 = (unsigned int*)IM_ALLOC(new_size * 4);
+        memcpy(pixels_rgba32, atlas->TexPixelsRGBA32, old_size * 4);
+        for (size_t n = old_size; n < new_size; n++)
+            pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = pixels_rgba32;
+    }
+    atlas->TexHeight = new_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    lazy->PackContext.pixels = atlas->TexPixelsAlpha8;
+    lazy->PackContext.height = atlas->TexHeight;
+
+    // Texture coordinates are normalized: compute V again from pixel rows, as Build() would have with this height
+    for (ImFont* font : atlas->Fonts)
+        for (ImFontGlyph& glyph : font->Glyphs)
+        {
+            glyph.V0 = IM_ROUND(glyph.V0 * old_height) * atlas->TexUvScale.y;
+            glyph.V1 = IM_ROUND(glyph.V1 * old_height) * atlas->TexUvScale.y;
+        }
+    ImFontAtlasBuildRenderDefaultTexData(atlas);
+    ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildLazyAddDirtyRect(lazy, 0, 0, atlas->TexWidth, atlas->TexHeight);
+}
+
+// Called by ImGui::NewFrame(), before anything is drawn with the texture coordinates of this frame
+void ImFontAtlasBuildUpdateLazyGlyphs(ImFontAtlas* atlas, bool renderer_has_tex_updates)
+{
+    ImFontAtlasLazyGlyphs* lazy = atlas->LazyGlyphs;
+    if (lazy == NULL)
+        return;
+    lazy->Enabled = renderer_has_tex_updates;
+    if (lazy->Pending.Size == 0)
+        return;
+
+    int tex_height = atlas->TexHeight;
+    for (const ImFontAtlasLazyPendingGlyph& pending : lazy->Pending)
+        tex_height = ImMax(tex_height, pending.Rect.y + pending.Rect.h);
+    tex_height = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (tex_height + 1) : ImUpperPowerOfTwo(tex_height);
+    ImFontAtlasBuildLazyGrowTexture(atlas, tex_height);
+    for (ImFontAtlasLazyPendingGlyph& pending : lazy->Pending)
+        ImFontAtlasBuildLazyRenderGlyph(atlas, pending.SrcIndex, pending.Codepoint, &pending.Rect);
+    lazy->Pending.resize(0);
+}
+
+void ImFontAtlasBuildClearLazyGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasLazyGlyphs* lazy = atlas->LazyGlyphs;
+    if (lazy == NULL)
+        return;
+    stbtt_PackEnd(&lazy->PackContext);
+    lazy->Srcs.clear_destruct();
+    IM_DELETE(lazy);
+    atlas->LazyGlyphs = NULL;
+}
+
+bool    ImFontAtlas::TakeTexDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h)
+{
+    ImFontAtlasLazyGlyphs* lazy = LazyGlyphs;
+    if (lazy == NULL || lazy->DirtyX0 >= lazy->DirtyX1)
+        return false;
+    *out_x = lazy->DirtyX0;
+    *out_y = lazy->DirtyY0;
+    *out_w = lazy->DirtyX1 - lazy->DirtyX0;
+    *out_h = lazy->DirtyY1 - lazy->DirtyY0;
+    lazy->DirtyX0 = lazy->DirtyY0 = lazy->DirtyX1 = lazy->DirtyY1 = 0;
+    return true;
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2894,6 +3467,19 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         dst_tmp.GlyphsHighest = ImMax(dst_tmp.GlyphsHighest, src_tmp.GlyphsHighest);
     }
 
+    // With ImFontAtlasFlags_LazyGlyphs, most glyphs go to the lazy sets instead of being rasterized now
+    ImFontAtlasLazyGlyphs* lazy = NULL;
+    if (atlas->Flags & ImFontAtlasFlags_LazyGlyphs)
+    {
+        lazy = IM_NEW(ImFontAtlasLazyGlyphs)();
+        lazy->Srcs.resize(src_tmp_array.Size, ImFontAtlasLazySrc());
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            lazy->Srcs[src_i].FontInfo = src_tmp_array[src_i].FontInfo;
+            lazy->Srcs[src_i].GlyphsSet.Create(src_tmp_array[src_i].GlyphsHighest + 1);
+        }
+    }
+
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
     int total_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2911,6 +3497,12 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
+                if (lazy && ImFontAtlasBuildIsGlyphLazy(atlas->ConfigData[src_i], codepoint))
+                {
+                    lazy->Srcs[src_i].GlyphsSet.SetBit(codepoint);
+                    dst_tmp.GlyphsSet.SetBit(codepoint);
+                    continue;
+                }
 
                 // Add to avail set/counters
                 src_tmp.GlyphsCount++;
@@ -2943,6 +3535,25 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
+    // Split the glyphs of each source font into chunks for the gather and render steps
+    const int CHUNK_GLYPHS = 256;
+    ImFontBuildJobs jobs;
+    jobs.atlas = atlas;
+    jobs.SrcTmp = src_tmp_array.Data;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += CHUNK_GLYPHS)
+        {
+            ImFontBuildChunk chunk = { src_i, glyph_i, ImMin(CHUNK_GLYPHS, src_tmp_array[src_i].GlyphsCount - glyph_i), 0 };
+            jobs.Chunks.push_back(chunk);
+        }
+#ifdef IMGUI_USE_THREADED_FONT_BUILD
+    ImFontBuildThreadAllocator thread_allocator;
+    ImGui::GetAllocatorFunctions(&thread_allocator.AllocFunc, &thread_allocator.FreeFunc, &thread_allocator.UserData);
+    jobs.AllocContext = &thread_allocator;
+#else
+    jobs.AllocContext = NULL;
+#endif
+
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
     int total_surface = 0;
     int buf_rects_out_n = 0;
@@ -2968,20 +3579,12 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
-
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
-        {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + pack_padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + pack_padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
-        }
     }
+
+    // Gather the sizes of all rectangles we will need to pack
+    ImFontAtlasBuildRunJobs(&jobs, ImFontAtlasBuildGatherChunk);
+    for (const ImFontBuildChunk& chunk : jobs.Chunks)
+        total_surface += chunk.Surface;
     for (int i = 0; i < atlas->CustomRects.Size; i++)
         total_surface += (atlas->CustomRects[i].Width + pack_padding) * (atlas->CustomRects[i].Height + pack_padding);
 
@@ -3028,30 +3631,16 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
+    jobs.PackContext = spc;
+    ImFontAtlasBuildRunJobs(&jobs, ImFontAtlasBuildRenderChunk);
+    for (ImFontBuildSrcData& src_tmp : src_tmp_array)
         src_tmp.Rects = NULL;
-    }
 
-    // End packing
-    stbtt_PackEnd(&spc);
+    // End packing (lazy glyphs keep packing into the free space left)
+    if (lazy)
+        lazy->PackContext = spc;
+    else
+        stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
@@ -3071,31 +3660,18 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         const float ascent = ImCeil(unscaled_ascent * font_scale);
         const float descent = ImFloor(unscaled_descent * font_scale);
         ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
-        const float font_off_x = cfg.GlyphOffset.x;
-        const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
-
-        const float inv_rasterization_scale = 1.0f / cfg.RasterizerDensity;
 
+        // Register glyphs
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
-        {
-            // Register glyph
-            const int codepoint = src_tmp.GlyphsList[glyph_i];
-            const stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
-            stbtt_aligned_quad q;
-            float unused_x = 0.0f, unused_y = 0.0f;
-            stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
-            float x0 = q.x0 * inv_rasterization_scale + font_off_x;
-            float y0 = q.y0 * inv_rasterization_scale + font_off_y;
-            float x1 = q.x1 * inv_rasterization_scale + font_off_x;
-            float y1 = q.y1 * inv_rasterization_scale + font_off_y;
-            dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
-        }
+            ImFontAtlasBuildAddPackedGlyph(atlas, cfg, src_tmp.PackedChars, glyph_i, src_tmp.GlyphsList[glyph_i]);
     }
 
     // Cleanup
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+    if (lazy)
+        ImFontAtlasBuildInitLazyGlyphs(atlas, lazy);
     return true;
 }
 
@@ -3106,6 +3682,14 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+#else
+
+// ImFontAtlasFlags_LazyGlyphs is implemented by the stb_truetype builder only
+const ImFontGlyph* ImFontAtlasBuildLazyGlyph(ImFontAtlas*, ImFont*, ImWchar) { return NULL; }
+void ImFontAtlasBuildUpdateLazyGlyphs(ImFontAtlas*, bool) {}
+void ImFontAtlasBuildClearLazyGlyphs(ImFontAtlas*) {}
+bool ImFontAtlas::TakeTexDirtyRect(int*, int*, int*, int*) { return false; }
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasUpdateConfigDataPointers(ImFontAtlas* atlas)
@@ -3330,6 +3914,298 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     atlas->TexReady = true;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas: build cache
+//-------------------------------------------------------------------------
+// The output of Build() saved to disk: texture pixels, glyph tables and custom rectangle positions, keyed by a hash
+// of everything Build() reads (font data, sizes, ranges, font and atlas options). Loading it skips rasterization.
+// File layout, native endianness:
+// - ImFontAtlasCacheHeader
+// - ImFontAtlasCacheFont[FontsCount], ImFontGlyph[GlyphsCount] (all fonts, in order), ImU16[CustomRectsCount * 2] (X, Y)
+// - Alpha8 then RGBA32 pixels (either may be missing), starting at PixelsOffset which is 64 bytes aligned
+//-------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_CACHE_VERSION     1
+
+enum ImFontAtlasCachePixels_
+{
+    ImFontAtlasCachePixels_Alpha8   = 1 << 0,
+    ImFontAtlasCachePixels_RGBA32   = 1 << 1,
+    ImFontAtlasCachePixels_Colors   = 1 << 2,   // TexPixelsUseColors
+};
+
+struct ImFontAtlasCacheHeader
+{
+    char                Magic[8];           // "ImAtlas"
+    ImU32               Version;            // IM_FONT_ATLAS_CACHE_VERSION
+    ImU32               ImGuiVersion;       // IMGUI_VERSION_NUM: ImFont/ImFontGlyph output may change between versions
+    ImU32               ByteOrder;          // 0x01020304
+    ImU32               SizeOfGlyph;        // sizeof(ImFontGlyph) | (sizeof(ImWchar) << 16)
+    ImU64               Key;                // ImFontAtlasCacheCalcKey()
+    int                 TexWidth, TexHeight;
+    int                 FontsCount, GlyphsCount, CustomRectsCount;
+    ImU32               PixelsFlags;        // ImFontAtlasCachePixels_
+    ImU32               PixelsOffset;
+    ImVec2              TexUvScale;
+    ImVec2              TexUvWhitePixel;
+    ImVec4              TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+};
+
+struct ImFontAtlasCacheFont
+{
+    float               FontSize, Ascent, Descent;
+    int                 MetricsTotalSurface;
+    int                 GlyphsCount;
+};
+
+static void ImFontAtlasCacheInitHeader(ImFontAtlasCacheHeader* header, ImU64 key)
+{
+    memset(header, 0, sizeof(*header));
+    memcpy(header->Magic, "ImAtlas", 8);
+    header->Version = IM_FONT_ATLAS_CACHE_VERSION;
+    header->ImGuiVersion = IMGUI_VERSION_NUM;
+    header->ByteOrder = 0x01020304;
+    header->SizeOfGlyph = (ImU32)(sizeof(ImFontGlyph) | (sizeof(ImWchar) << 16));
+    header->Key = key;
+}
+
+static int ImFontAtlasCacheFindFont(ImFontAtlas* atlas, const ImFont* font)
+{
+    return atlas->Fonts.find_index(const_cast<ImFont*>(font));
+}
+
+// 64-bit word-at-a-time hash (MurmurHash64A). The key covers whole font files (the CJK ones weigh 10-20 MB) and is
+// computed on every start, where ImHashData() would cost more than what the cache saves.
+static ImU64 ImFontAtlasCacheHash(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 m = 0xC6A4A7935BD1E995ULL;
+    const int r = 47;
+    ImU64 h = seed ^ ((ImU64)data_size * m);
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = data + (data_size & ~(size_t)7);
+    for (; data != data_end; data += 8)
+    {
+        ImU64 k;
+        memcpy(&k, data, sizeof(k));
+        k *= m; k ^= k >> r; k *= m;
+        h ^= k; h *= m;
+    }
+    if (const size_t rem = data_size & 7)
+    {
+        ImU64 k = 0;
+        for (size_t n = 0; n < rem; n++)
+            k |= (ImU64)data[n] << (n * 8);
+        h ^= k; h *= m;
+    }
+    h ^= h >> r; h *= m; h ^= h >> r;
+    return h;
+}
+
+// Hash of the inputs of Build(). Fields are hashed one by one: ImFontConfig holds pointers and padding.
+static ImU64 ImFontAtlasCacheCalcKey(ImFontAtlas* atlas)
+{
+    const int atlas_ints[] = { (int)atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, (int)atlas->FontBuilderFlags, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->CustomRects.Size };
+    ImU64 key = ImFontAtlasCacheHash(atlas_ints, sizeof(atlas_ints), 0);
+#ifdef IMGUI_ENABLE_FREETYPE
+    key = ImFontAtlasCacheHash("freetype", 8, key);
+#endif
+    for (const ImFontConfig& cfg : atlas->ConfigData)
+    {
+        const int cfg_ints[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.FontBuilderFlags, (int)cfg.EllipsisChar, ImFontAtlasCacheFindFont(atlas, cfg.DstFont) };
+        const float cfg_floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply, cfg.RasterizerDensity };
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] != 0)
+            ranges_count++;
+        key = ImFontAtlasCacheHash(cfg_ints, sizeof(cfg_ints), key);
+        key = ImFontAtlasCacheHash(cfg_floats, sizeof(cfg_floats), key);
+        key = ImFontAtlasCacheHash(ranges, (size_t)ranges_count * sizeof(ImWchar), key);
+        key = ImFontAtlasCacheHash(cfg.FontData, (size_t)cfg.FontDataSize, key);
+    }
+    for (const ImFontAtlasCustomRect& r : atlas->CustomRects)
+    {
+        const int rect_ints[] = { r.Width, r.Height, (int)r.GlyphID, (int)r.GlyphColored, ImFontAtlasCacheFindFont(atlas, r.Font) };
+        const float rect_floats[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        key = ImFontAtlasCacheHash(rect_ints, sizeof(rect_ints), key);
+        key = ImFontAtlasCacheHash(rect_floats, sizeof(rect_floats), key);
+    }
+    return key;
+}
+
+// The output of a custom FontBuilderIO can't be told apart from the default one, so only the default builder is cached.
+// With ImFontAtlasFlags_LazyGlyphs, the glyphs added after Build() aren't part of the saved output.
+static bool ImFontAtlasCacheIsSupported(ImFontAtlas* atlas)
+{
+    return atlas->FontBuilderIO == NULL && !(atlas->Flags & ImFontAtlasFlags_LazyGlyphs);
+}
+
+// Returns true and leaves the atlas built (as after Build()) when 'filename' was saved from the same inputs.
+// Otherwise the atlas is left untouched, and Build() + SaveCacheToDisk() will refresh the file.
+bool    ImFontAtlas::LoadCacheFromDisk(const char* filename)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (!ImFontAtlasCacheIsSupported(this))
+        return false;
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this); // Register our own custom rectangles as Build() does, they are part of the key
+
+    ImFileHandle f = ImFileOpen(filename, "rb");
+    if (f == NULL)
+        return false;
+
+    // Check the header against the current inputs, and the file size against the header
+    ImFontAtlasCacheHeader header, expected;
+    memset(&header, 0, sizeof(header));
+    ImFontAtlasCacheInitHeader(&expected, ImFontAtlasCacheCalcKey(this));
+    const ImU64 file_size = ImFileGetSize(f);
+    bool ok = ImFileRead(&header, 1, sizeof(header), f) == sizeof(header);
+    ok = ok && memcmp(&header, &expected, offsetof(ImFontAtlasCacheHeader, TexWidth)) == 0;
+    ok = ok && header.FontsCount == Fonts.Size && header.CustomRectsCount == CustomRects.Size;
+    ok = ok && header.TexWidth > 0 && header.TexHeight > 0 && header.GlyphsCount > 0 && header.PixelsFlags != 0;
+    const size_t tex_size = ok ? (size_t)header.TexWidth * (size_t)header.TexHeight : 0;
+    const size_t meta_size = (size_t)header.FontsCount * sizeof(ImFontAtlasCacheFont) + (size_t)header.GlyphsCount * sizeof(ImFontGlyph) + (size_t)header.CustomRectsCount * sizeof(ImU16) * 2;
+    ok = ok && header.PixelsOffset >= sizeof(header) + meta_size;
+    ok = ok && file_size == header.PixelsOffset + ((header.PixelsFlags & ImFontAtlasCachePixels_Alpha8) ? tex_size : 0) + ((header.PixelsFlags & ImFontAtlasCachePixels_RGBA32) ? tex_size * 4 : 0);
+
+    // Read everything before touching the atlas, so a bad file leaves it as it was
+    ImVector<char> meta;
+    unsigned char* pixels_alpha8 = NULL;
+    unsigned int* pixels_rgba32 = NULL;
+    if (ok)
+    {
+        meta.resize((int)(header.PixelsOffset - sizeof(header)));
+        ok = ImFileRead(meta.Data, 1, (ImU64)meta.Size, f) == (ImU64)meta.Size;
+    }
+    if (ok && (header.PixelsFlags & ImFontAtlasCachePixels_Alpha8))
+    {
+        pixels_alpha8 = (unsigned char*)IM_ALLOC(tex_size);
+        ok = ImFileRead(pixels_alpha8, 1, tex_size, f) == tex_size;
+    }
+    if (ok && (header.PixelsFlags & ImFontAtlasCachePixels_RGBA32))
+    {
+        pixels_rgba32 = (unsigned int*)IM_ALLOC(tex_size * 4);
+        ok = ImFileRead(pixels_rgba32, 1, tex_size * 4, f) == tex_size * 4;
+    }
+    ImFileClose(f);
+
+    // Sanity check the tables: a damaged file must not make BuildLookupTable() or CalcCustomRectUV() go out of bounds
+    const ImFontAtlasCacheFont* src_fonts = ok ? (const ImFontAtlasCacheFont*)(void*)meta.Data : NULL;
+    const ImFontGlyph* src_glyphs = ok ? (const ImFontGlyph*)(void*)(src_fonts + header.FontsCount) : NULL;
+    const ImU16* src_rects = ok ? (const ImU16*)(void*)(src_glyphs + header.GlyphsCount) : NULL;
+    int glyphs_count = 0;
+    for (int font_n = 0; ok && font_n < header.FontsCount; font_n++)
+    {
+        ok = src_fonts[font_n].GlyphsCount > 0 && src_fonts[font_n].GlyphsCount < 0xFFFF;
+        glyphs_count += src_fonts[font_n].GlyphsCount;
+    }
+    ok = ok && glyphs_count == header.GlyphsCount;
+    for (int glyph_n = 0; ok && glyph_n < header.GlyphsCount; glyph_n++)
+        ok = src_glyphs[glyph_n].Codepoint <= IM_UNICODE_CODEPOINT_MAX;
+    for (int rect_n = 0; ok && rect_n < header.CustomRectsCount; rect_n++)
+        ok = src_rects[rect_n * 2] + CustomRects[rect_n].Width <= header.TexWidth && src_rects[rect_n * 2 + 1] + CustomRects[rect_n].Height <= header.TexHeight;
+    if (!ok)
+    {
+        IM_FREE(pixels_alpha8);
+        IM_FREE(pixels_rgba32);
+        return false;
+    }
+
+    // Restore the state ImFontAtlasBuildWithStbTruetype() + ImFontAtlasBuildFinish() leave behind
+    TexID = (ImTextureID)NULL;
+    ClearTexData();
+    TexPixelsAlpha8 = pixels_alpha8;
+    TexPixelsRGBA32 = pixels_rgba32;
+    TexPixelsUseColors = (header.PixelsFlags & ImFontAtlasCachePixels_Colors) != 0;
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = header.TexUvScale;
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    memcpy(TexUvLines, header.TexUvLines, sizeof(TexUvLines));
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        CustomRects[rect_n].X = src_rects[rect_n * 2];
+        CustomRects[rect_n].Y = src_rects[rect_n * 2 + 1];
+    }
+    ImFontAtlasUpdateConfigDataPointers(this);
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        ImFont* font = Fonts[font_n];
+        const ImFontAtlasCacheFont& src = src_fonts[font_n];
+        font->ClearOutputData();
+        font->ContainerAtlas = this;
+        font->FontSize = src.FontSize;
+        font->Ascent = src.Ascent;
+        font->Descent = src.Descent;
+        font->MetricsTotalSurface = src.MetricsTotalSurface;
+        font->Glyphs.resize(src.GlyphsCount);
+        memcpy(font->Glyphs.Data, src_glyphs, (size_t)font->Glyphs.size_in_bytes());
+        font->BuildLookupTable();
+        src_glyphs += src.GlyphsCount;
+    }
+    TexReady = true;
+    return true;
+}
+
+// Save the output of Build() for LoadCacheFromDisk(). Call it right after Build(): the pixels you render into custom
+// rectangles don't need to be saved, as you render them again after a load.
+bool    ImFontAtlas::SaveCacheToDisk(const char* filename)
+{
+    IM_ASSERT(IsBuilt() && "Call Build() before SaveCacheToDisk()!");
+    if (!ImFontAtlasCacheIsSupported(this) || !IsBuilt() || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL))
+        return false;
+
+    ImFontAtlasCacheHeader header;
+    ImFontAtlasCacheInitHeader(&header, ImFontAtlasCacheCalcKey(this));
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.FontsCount = Fonts.Size;
+    header.CustomRectsCount = CustomRects.Size;
+    header.PixelsFlags = (TexPixelsAlpha8 ? ImFontAtlasCachePixels_Alpha8 : 0) | (TexPixelsRGBA32 ? ImFontAtlasCachePixels_RGBA32 : 0) | (TexPixelsUseColors ? ImFontAtlasCachePixels_Colors : 0);
+    header.TexUvScale = TexUvScale;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    memcpy(header.TexUvLines, TexUvLines, sizeof(TexUvLines));
+
+    ImVector<ImFontAtlasCacheFont> fonts;
+    ImVector<ImU16> rects;
+    fonts.resize(Fonts.Size);
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        const ImFont* font = Fonts[font_n];
+        fonts[font_n].FontSize = font->FontSize;
+        fonts[font_n].Ascent = font->Ascent;
+        fonts[font_n].Descent = font->Descent;
+        fonts[font_n].MetricsTotalSurface = font->MetricsTotalSurface;
+        fonts[font_n].GlyphsCount = font->Glyphs.Size;
+        header.GlyphsCount += font->Glyphs.Size;
+    }
+    for (const ImFontAtlasCustomRect& r : CustomRects)
+    {
+        rects.push_back(r.X);
+        rects.push_back(r.Y);
+    }
+    const size_t meta_size = sizeof(header) + (size_t)fonts.size_in_bytes() + (size_t)header.GlyphsCount * sizeof(ImFontGlyph) + (size_t)rects.size_in_bytes();
+    header.PixelsOffset = (ImU32)((meta_size + 63) & ~(size_t)63);
+
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    static const char zeroes[64] = {};
+    const size_t tex_size = (size_t)TexWidth * (size_t)TexHeight;
+    bool ok = ImFileWrite(&header, 1, sizeof(header), f) == sizeof(header);
+    ok = ok && ImFileWrite(fonts.Data, 1, (ImU64)fonts.size_in_bytes(), f) == (ImU64)fonts.size_in_bytes();
+    for (int font_n = 0; ok && font_n < Fonts.Size; font_n++)
+        ok = ImFileWrite(Fonts[font_n]->Glyphs.Data, 1, (ImU64)Fonts[font_n]->Glyphs.size_in_bytes(), f) == (ImU64)Fonts[font_n]->Glyphs.size_in_bytes();
+    ok = ok && ImFileWrite(rects.Data, 1, (ImU64)rects.size_in_bytes(), f) == (ImU64)rects.size_in_bytes();
+    ok = ok && ImFileWrite(zeroes, 1, header.PixelsOffset - meta_size, f) == header.PixelsOffset - meta_size;
+    if (ok && TexPixelsAlpha8)
+        ok = ImFileWrite(TexPixelsAlpha8, 1, tex_size, f) == tex_size;
+    if (ok && TexPixelsRGBA32)
+        ok = ImFileWrite(TexPixelsRGBA32, 1, tex_size * 4, f) == tex_size * 4;
+    ok &= ImFileClose(f);
+    return ok;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas: glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -3654,6 +4530,7 @@ ImFont::ImFont()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    TextSizeCache = NULL;
 }
 
 ImFont::~ImFont()
@@ -3674,6 +4551,8 @@ void    ImFont::ClearOutputData()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    IM_DELETE(TextSizeCache);
+    TextSizeCache = NULL;
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3697,6 +4576,8 @@ void ImFont::BuildLookupTable()
     IndexLookup.clear();
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    if (TextSizeCache)
+        TextSizeCache->Clear();
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
@@ -3857,6 +4738,8 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    if (TextSizeCache)
+        TextSizeCache->Clear();
 }
 
 // Find glyph, return fallback if missing
@@ -3866,7 +4749,10 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c)
         return FallbackGlyph;
     const ImWchar i = IndexLookup.Data[c];
     if (i == (ImWchar)-1)
-        return FallbackGlyph;
+    {
+        const ImFontGlyph* glyph = ContainerAtlas->LazyGlyphs ? ImFontAtlasBuildLazyGlyph(ContainerAtlas, this, c) : NULL;
+        return glyph ? glyph : FallbackGlyph;
+    }
     return &Glyphs.Data[i];
 }
 
@@ -3876,7 +4762,7 @@ const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c)
         return NULL;
     const ImWchar i = IndexLookup.Data[c];
     if (i == (ImWchar)-1)
-        return NULL;
+        return ContainerAtlas->LazyGlyphs ? ImFontAtlasBuildLazyGlyph(ContainerAtlas, this, c) : NULL;
     return &Glyphs.Data[i];
 }
 
@@ -3993,11 +4879,159 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+#ifdef IMGUI_USE_TEXT_SIZE_CACHE
+
+#ifndef IMGUI_TEXT_SIZE_CACHE_ENTRIES
+#define IMGUI_TEXT_SIZE_CACHE_ENTRIES   4096
+#endif
+static_assert(IMGUI_TEXT_SIZE_CACHE_ENTRIES > 0 && (IMGUI_TEXT_SIZE_CACHE_ENTRIES & (IMGUI_TEXT_SIZE_CACHE_ENTRIES - 1)) == 0, "IMGUI_TEXT_SIZE_CACHE_ENTRIES must be a power of two");
+
+// 64-bit MurmurHash64A: reading 8 bytes per step is what makes a lookup cheaper than measuring the string again, which the
+// byte-at-a-time CRC32 of ImHashData() is not. 64 bits also make two strings of the same length sharing a hash unlikely.
+static ImU64 ImFontTextSizeCacheHash(const char* text, size_t len)
+{
+    const ImU64 m = 0xC6A4A7935BD1E995ULL;
+    const int r = 47;
+    ImU64 h = len * m;
+    const char* text_end = text + (len & ~(size_t)7);
+    for (; text != text_end; text += 8)
+    {
+        ImU64 k;
+        memcpy(&k, text, sizeof(k));
+        k *= m; k ^= k >> r; k *= m;
+        h ^= k; h *= m;
+    }
+    if (const size_t rem = len & 7)
+    {
+        ImU64 k = 0;
+        memcpy(&k, text, rem); // Byte order depends on the host, which is fine: the hash never leaves the process
+        h ^= k; h *= m;
+    }
+    h ^= h >> r; h *= m; h ^= h >> r;
+    return h;
+}
+
+static void ImFontTextSizeCacheUnlink(ImFontTextSizeCache* cache, int entry_idx)
+{
+    ImFontTextSizeCacheEntry* entry = &cache->Entries.Data[entry_idx];
+    if (entry->Prev != -1)
+        cache->Entries.Data[entry->Prev].Next = entry->Next;
+    else
+        cache->MostRecent = entry->Next;
+    if (entry->Next != -1)
+        cache->Entries.Data[entry->Next].Prev = entry->Prev;
+    else
+        cache->LeastRecent = entry->Prev;
+}
+
+static void ImFontTextSizeCacheLinkFront(ImFontTextSizeCache* cache, int entry_idx)
+{
+    ImFontTextSizeCacheEntry* entry = &cache->Entries.Data[entry_idx];
+    entry->Prev = -1;
+    entry->Next = cache->MostRecent;
+    if (cache->MostRecent != -1)
+        cache->Entries.Data[cache->MostRecent].Prev = entry_idx;
+    else
+        cache->LeastRecent = entry_idx;
+    cache->MostRecent = entry_idx;
+}
+
+// Frees the slot of an entry, moving back the entries probed after it so that no lookup stops early on the hole.
+static void ImFontTextSizeCacheRemoveSlot(ImFontTextSizeCache* cache, int entry_idx)
+{
+    const int mask = cache->Slots.Size - 1;
+    int hole = (int)(cache->Entries.Data[entry_idx].Hash & (ImU64)mask);
+    while (cache->Slots.Data[hole] != entry_idx)
+        hole = (hole + 1) & mask;
+    for (int slot = (hole + 1) & mask; cache->Slots.Data[slot] != -1; slot = (slot + 1) & mask)
+    {
+        const int home = (int)(cache->Entries.Data[cache->Slots.Data[slot]].Hash & (ImU64)mask);
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            cache->Slots.Data[hole] = cache->Slots.Data[slot];
+            hole = slot;
+        }
+    }
+    cache->Slots.Data[hole] = -1;
+}
+
+// Returns the entry of a string, with its TextSize when *found is true, or else a new entry for the caller to fill.
+static ImFontTextSizeCacheEntry* ImFontTextSizeCacheFindOrAdd(ImFontTextSizeCache* cache, float size, float wrap_width, const char* text_begin, const char* text_end, bool* found)
+{
+    const int length = (int)(text_end - text_begin);
+    const ImU64 hash = ImFontTextSizeCacheHash(text_begin, (size_t)length);
+    if (cache->Slots.Size == 0)
+    {
+        cache->Entries.reserve(IMGUI_TEXT_SIZE_CACHE_ENTRIES);
+        cache->Slots.resize(IMGUI_TEXT_SIZE_CACHE_ENTRIES * 2);
+        memset(cache->Slots.Data, 0xFF, (size_t)cache->Slots.size_in_bytes());
+    }
+
+    const int mask = cache->Slots.Size - 1;
+    int slot = (int)(hash & (ImU64)mask);
+    for (; cache->Slots.Data[slot] != -1; slot = (slot + 1) & mask)
+    {
+        const int entry_idx = cache->Slots.Data[slot];
+        ImFontTextSizeCacheEntry* entry = &cache->Entries.Data[entry_idx];
+        if (entry->Hash != hash || entry->Length != length || entry->Size != size || entry->WrapWidth != wrap_width)
+            continue;
+        if (cache->MostRecent != entry_idx)
+        {
+            ImFontTextSizeCacheUnlink(cache, entry_idx);
+            ImFontTextSizeCacheLinkFront(cache, entry_idx);
+        }
+        cache->Hits++;
+        *found = true;
+        return entry;
+    }
+
+    int entry_idx;
+    if (cache->Entries.Size < IMGUI_TEXT_SIZE_CACHE_ENTRIES)
+    {
+        entry_idx = cache->Entries.Size;
+        cache->Entries.resize(entry_idx + 1);
+    }
+    else
+    {
+        // Removing the slot of the least recently used entry may move entries back into the free slot found above
+        entry_idx = cache->LeastRecent;
+        ImFontTextSizeCacheUnlink(cache, entry_idx);
+        ImFontTextSizeCacheRemoveSlot(cache, entry_idx);
+        for (slot = (int)(hash & (ImU64)mask); cache->Slots.Data[slot] != -1; slot = (slot + 1) & mask) {}
+    }
+    ImFontTextSizeCacheEntry* entry = &cache->Entries.Data[entry_idx];
+    entry->Hash = hash;
+    entry->Length = length;
+    entry->Size = size;
+    entry->WrapWidth = wrap_width;
+    cache->Slots.Data[slot] = entry_idx;
+    ImFontTextSizeCacheLinkFront(cache, entry_idx);
+    cache->Misses++;
+    *found = false;
+    return entry;
+}
+
+#endif // #ifdef IMGUI_USE_TEXT_SIZE_CACHE
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+#ifdef IMGUI_USE_TEXT_SIZE_CACHE
+    // Only whole strings are cached: a clipped measurement also returns where it stopped
+    ImFontTextSizeCacheEntry* cache_entry = NULL;
+    if (max_width == FLT_MAX && remaining == NULL)
+    {
+        if (TextSizeCache == NULL)
+            TextSizeCache = IM_NEW(ImFontTextSizeCache)();
+        bool found;
+        cache_entry = ImFontTextSizeCacheFindOrAdd(TextSizeCache, size, wrap_width, text_begin, text_end, &found);
+        if (found)
+            return cache_entry->TextSize;
+    }
+#endif
+
     const float line_height = size;
     const float scale = size / FontSize;
 
@@ -4067,6 +5101,10 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     if (remaining)
         *remaining = s;
+#ifdef IMGUI_USE_TEXT_SIZE_CACHE
+    if (cache_entry)
+        cache_entry->TextSize = text_size;
+#endif
 
     return text_size;
 }
@@ -3850,10 +3850,37 @@ IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API const ImFontGlyph* ImFontAtlasBuildLazyGlyph(ImFontAtlas* atlas, ImFont* font, ImWchar c);
+IMGUI_API void      ImFontAtlasBuildUpdateLazyGlyphs(ImFontAtlas* atlas, bool renderer_has_tex_updates);
+IMGUI_API void      ImFontAtlasBuildClearLazyGlyphs(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void      ImFontAtlasBuildExpandAlpha8ToRGBA32(const unsigned char* src, unsigned int* dst, size_t count);
+
+// Sizes of whole strings measured by ImFont::CalcTextSizeA(), with IMGUI_USE_TEXT_SIZE_CACHE. Entries are found through an open addressing
+// table on a 64-bit hash of the text and reused least recently used first. Two strings of the same length and hash are not told apart.
+struct ImFontTextSizeCacheEntry
+{
+    ImU64       Hash;
+    int         Length;         // In bytes
+    float       Size;
+    float       WrapWidth;
+    ImVec2      TextSize;
+    int         Prev, Next;     // Neighbors in the recently used list, -1 at its ends
+};
+
+struct ImFontTextSizeCache
+{
+    ImVector<ImFontTextSizeCacheEntry>  Entries;    // Up to IMGUI_TEXT_SIZE_CACHE_ENTRIES, reserved once
+    ImVector<int>                       Slots;      // Index in Entries by Hash, -1 for empty slots. Twice the capacity, allocated on first use.
+    int                                 MostRecent, LeastRecent;
+    ImU64                               Hits, Misses;
+
+    ImFontTextSizeCache()   { MostRecent = LeastRecent = -1; Hits = Misses = 0; }
+    void    Clear()         { Entries.resize(0); Slots.resize(0); MostRecent = LeastRecent = -1; } // Glyph advances changed
+};
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
@@ -8062,6 +8062,12 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
         ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // Insertions append in this mode: sort when starting an iteration, so selected items still come in ID order
+    if (!PreserveOrder && it == NULL)
+        for (ImGuiStoragePair* p = _Storage.Data.Data; p + 1 < it_end; p++)
+            if (p[0].key > p[1].key) { _Storage.BuildSortByKey(); break; }
+#endif
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8087,6 +8093,17 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // O(1) queries and appending inserts, no need for the sorted lookup + final sort
+    IM_UNUSED(size_before_amends);
+    if (!selected && storage->GetInt(id, 0) == 0)
+        return;
+    int* p_int = storage->GetIntRef(id, 0);
+    if (selected == (*p_int != 0))
+        return;
+    *p_int = selected ? selection_order : 0;
+    selection->Size += selected ? +1 : -1;
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8096,6 +8113,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
     else if (is_contained)
         it->val_i = selected ? selection_order : 0; // Modify in-place.
     selection->Size += selected ? +1 : -1;
+#endif
 }
 
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)